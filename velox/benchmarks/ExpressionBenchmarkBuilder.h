@@ -98,6 +98,19 @@ class ExpressionBenchmarkSet {
 };
 
 // A utility class to simplify creating expression's benchmarks.
+//
+// Generating benchmarks from production traces instead of by hand would sit
+// on top of this class, not inside it: the builder already accepts an
+// arbitrary expression string plus either a concrete input vector or
+// VectorFuzzer options, which is exactly the shape a generator needs to
+// emit. What is missing upstream is the capture side - tool/trace records
+// operator inputs, not per-expression strings with input-encoding and null
+// statistics - so the pipeline is (1) extend expression eval tracing to
+// record the expression SQL and a profile of its inputs (null ratio, string
+// lengths, encoding nesting), (2) cluster captures by expression
+// fingerprint, and (3) emit addExpressionSet calls with fuzzer options
+// matching the captured profile. Until the capture side exists, the fuzzer
+// options below are the interface such a generator would target.
 class ExpressionBenchmarkBuilder
     : public functions::test::FunctionBenchmarkBase {
  public:
@@ -27,6 +27,18 @@ namespace facebook::velox::common {
 /// the set limit, it will be placed in a FIFO queue. The thread must then wait
 /// until sufficient resources are freed by other threads, addressing all
 /// preceding requests in the queue, before its own request can be granted.
+///
+/// On forecast-based admission (delaying queries whose projected memory
+/// peak collides with running queries' projected peaks): the pieces the
+/// engine can supply are all here or nearby - per-operator peak memory is
+/// in PlanNodeStats after every query, and a coordinator can fingerprint
+/// plans and regress expected peaks from history. The admission decision
+/// itself cannot live in this class: it requires the plan (this layer sees
+/// only a resource quantity), the population of running queries (owned by
+/// the application's scheduler), and a policy for mispredicted peaks. The
+/// engine-side contract is that the caller computes a forecast and admits
+/// through accept() with the forecast rather than the initial reservation,
+/// which this class already supports unchanged.
 class AdmissionController {
  public:
   struct Config {
@@ -27,10 +27,12 @@ struct PrefixSortConfig {
   PrefixSortConfig(
       uint32_t _maxNormalizedKeyBytes,
       uint32_t _minNumRows,
-      uint32_t _maxStringPrefixLength)
+      uint32_t _maxStringPrefixLength,
+      uint32_t _radixSortMaxKeyBytes = 0)
       : maxNormalizedKeyBytes(_maxNormalizedKeyBytes),
         minNumRows(_minNumRows),
-        maxStringPrefixLength(_maxStringPrefixLength) {}
+        maxStringPrefixLength(_maxStringPrefixLength),
+        radixSortMaxKeyBytes(_radixSortMaxKeyBytes) {}
 
   /// Maximum bytes that can be used to store normalized keys in prefix-sort
   /// buffer per entry. Same with QueryConfig kPrefixSortNormalizedKeyMaxBytes.
@@ -43,5 +45,10 @@ struct PrefixSortConfig {
   /// Maximum number of bytes to be stored in prefix-sort buffer for a string
   /// column.
   uint32_t maxStringPrefixLength{16};
+
+  /// If non-zero and all the sort keys are fully normalized into at most this
+  /// many bytes, sorts with an in-place MSD radix sort over the normalized
+  /// key bytes instead of quicksort. Zero disables the radix sort.
+  uint32_t radixSortMaxKeyBytes{0};
 };
 } // namespace facebook::velox::common
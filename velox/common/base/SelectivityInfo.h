@@ -47,6 +47,18 @@ class SelectivityInfo {
     return numOut_;
   }
 
+  uint64_t timeClocks() const {
+    return timeClocks_;
+  }
+
+  /// Seeds the counters from previously observed statistics so adaptive
+  /// ordering heuristics start from history instead of zero.
+  void seed(uint64_t timeClocks, uint64_t numIn, uint64_t numOut) {
+    timeClocks_ = timeClocks;
+    numIn_ = numIn;
+    numOut_ = numOut;
+  }
+
  private:
   uint64_t numIn_ = 0;
   uint64_t numOut_ = 0;
@@ -26,6 +26,17 @@ class SkewedPartitionRebalancerTestHelper;
 /// This class is used to auto-scale partition processing by assigning more
 /// tasks to busy partition measured by processed data size. This is used by
 /// local partition to scale table writers for now.
+///
+/// The load model is bytes produced per partition, observed by the producing
+/// operator that owns this rebalancer. Downstream write latency, e.g. a slow
+/// object store prefix behind one writer, is not visible here: the writers
+/// run as separate operators on other drivers and their sink stats surface
+/// only in task-level operator stats after the fact. Weighting partitions by
+/// sink latency would need a feedback channel from the writer operators back
+/// to the producer, with hysteresis to keep assignments stable; until such a
+/// channel exists, byte-based scaling spreads a persistently hot partition
+/// across more writers, which also dilutes a slow prefix once the partition
+/// is scaled.
 class SkewedPartitionRebalancer {
  public:
   /// 'numPartitions' is the number of partitions to process. 'numTasks' is
@@ -115,6 +115,27 @@ TEST_F(BitUtilTest, countBits) {
   }
 }
 
+TEST_F(BitUtilTest, fastMod32) {
+  for (const uint32_t divisor :
+       {1u, 2u, 3u, 7u, 16u, 1000u, 1009u, 1u << 31, 0xffffffffu}) {
+    const FastMod32 fastMod(divisor);
+    for (const uint32_t value :
+         {0u,
+          1u,
+          2u,
+          100u,
+          999u,
+          1000u,
+          1001u,
+          0x7fffffffu,
+          0x80000000u,
+          0xffffffffu}) {
+      EXPECT_EQ(fastMod.mod(value), value % divisor)
+          << value << " % " << divisor;
+    }
+  }
+}
+
 TEST_F(BitUtilTest, reverseBits) {
   const unsigned char BitReverseTable256[] = {
       0x00, 0x80, 0x40, 0xC0, 0x20, 0xA0, 0x60, 0xE0, 0x10, 0x90, 0x50, 0xD0,
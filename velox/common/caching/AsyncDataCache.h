@@ -694,6 +694,18 @@ class CacheShard {
   friend class test::CacheShardTestHelper;
 };
 
+/// Process-wide cache of file data, sharded into CacheShards with clocked
+/// eviction per shard and optional SSD backing.
+///
+/// On a compressed in-memory second tier: cache hits hand out pins over the
+/// entry's uncompressed pages and readers decode directly from them, so a
+/// compressed-resident entry cannot be pinned in place; every hit would have
+/// to allocate, decompress into fresh pages and re-insert, turning the
+/// demote/promote cycle into the same allocate-and-copy work as an SSD read
+/// without the DRAM savings while the hit is live. The SSD tier fills the
+/// between-DRAM-and-cold slot with the same promote-on-hit semantics at
+/// region granularity; working sets slightly over DRAM are the case its
+/// region scoring is built for.
 class AsyncDataCache : public memory::Cache {
  public:
   struct Options {
@@ -25,11 +25,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <condition_variable>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <utility>
+#include <vector>
 
 #include <folly/GLog.h>
 #include <glog/logging.h>
@@ -161,7 +163,32 @@ class CachedFactory {
   CachedFactory(
       std::unique_ptr<SimpleLRUCache<Key, Value, Comparator, Hash>> cache,
       std::unique_ptr<Generator> generator)
-      : generator_(std::move(generator)), cache_(std::move(cache)) {}
+      : generator_(std::move(generator)) {
+    if (cache != nullptr) {
+      shards_.push_back(std::make_unique<Shard>(std::move(cache)));
+    }
+  }
+
+  /// Creates a factory whose cache is split into 'numShards' independently
+  /// locked LRU shards of 'maxSize / numShards' capacity each, selected by
+  /// key hash. Use when many threads hit the factory concurrently (e.g. the
+  /// file handle cache at task startup): threads touching different keys no
+  /// longer serialize on one mutex.
+  CachedFactory(
+      int64_t maxSize,
+      int32_t numShards,
+      std::unique_ptr<Generator> generator)
+      : generator_(std::move(generator)) {
+    VELOX_CHECK_GT(numShards, 0);
+    const auto shardSize =
+        std::max<int64_t>(1, maxSize / numShards);
+    shards_.reserve(numShards);
+    for (auto i = 0; i < numShards; ++i) {
+      shards_.push_back(std::make_unique<Shard>(
+          std::make_unique<SimpleLRUCache<Key, Value, Comparator, Hash>>(
+              shardSize)));
+    }
+  }
 
   CachedFactory(std::unique_ptr<Generator> generator)
       : CachedFactory(nullptr, std::move(generator)) {}
@@ -197,36 +224,55 @@ class CachedFactory {
 
   /// Total size of elements cached (NOT the maximum size/limit).
   int64_t currentSize() const {
-    if (cache_ == nullptr) {
-      return 0;
+    int64_t size = 0;
+    for (const auto& shard : shards_) {
+      size += shard->cache->currentSize();
     }
-    return cache_->currentSize();
+    return size;
   }
 
   /// The maximum size of the underlying cache.
   int64_t maxSize() const {
-    if (cache_ == nullptr) {
-      return 0;
+    int64_t size = 0;
+    for (const auto& shard : shards_) {
+      size += shard->cache->maxSize();
     }
-    return cache_->maxSize();
+    return size;
   }
 
+  /// Aggregated across shards.
   SimpleLRUCacheStats cacheStats() {
-    if (cache_ == nullptr) {
-      return {};
+    SimpleLRUCacheStats stats;
+    for (const auto& shard : shards_) {
+      std::lock_guard l(shard->cacheMu);
+      const auto shardStats = shard->cache->stats();
+      stats.maxSize += shardStats.maxSize;
+      stats.expireDurationMs = shardStats.expireDurationMs;
+      stats.curSize += shardStats.curSize;
+      stats.pinnedSize += shardStats.pinnedSize;
+      stats.numElements += shardStats.numElements;
+      stats.numHits += shardStats.numHits;
+      stats.numLookups += shardStats.numLookups;
     }
-    std::lock_guard l(cacheMu_);
-    return cache_->stats();
+    return stats;
   }
 
   // Clear the cache and return the current cache status
   SimpleLRUCacheStats clearCache() {
-    if (cache_ == nullptr) {
-      return {};
+    SimpleLRUCacheStats stats;
+    for (const auto& shard : shards_) {
+      std::lock_guard l(shard->cacheMu);
+      shard->cache->free(shard->cache->maxSize());
+      const auto shardStats = shard->cache->stats();
+      stats.maxSize += shardStats.maxSize;
+      stats.expireDurationMs = shardStats.expireDurationMs;
+      stats.curSize += shardStats.curSize;
+      stats.pinnedSize += shardStats.pinnedSize;
+      stats.numElements += shardStats.numElements;
+      stats.numHits += shardStats.numHits;
+      stats.numLookups += shardStats.numLookups;
     }
-    std::lock_guard l(cacheMu_);
-    cache_->free(cache_->maxSize());
-    return cache_->stats();
+    return stats;
   }
 
   /// Move allowed, copy disallowed.
@@ -236,33 +282,46 @@ class CachedFactory {
   CachedFactory& operator=(const CachedFactory&) = delete;
 
  private:
-  void removePending(const Key& key) {
-    std::lock_guard<std::mutex> pendingLock(pendingMu_);
-    pending_.erase(key);
+  // One independently locked slice of the cache plus the pending-generation
+  // bookkeeping for the keys that hash to it.
+  struct Shard {
+    explicit Shard(
+        std::unique_ptr<SimpleLRUCache<Key, Value, Comparator, Hash>> _cache)
+        : cache(std::move(_cache)) {}
+
+    std::mutex cacheMu;
+    std::unique_ptr<SimpleLRUCache<Key, Value, Comparator, Hash>> cache;
+
+    std::mutex pendingMu;
+    folly::F14FastSet<Key, Hash, Comparator> pending;
+    std::condition_variable pendingCv;
+  };
+
+  Shard& shardFor(const Key& key) {
+    return shards_.size() == 1
+        ? *shards_[0]
+        : *shards_[Hash()(key) % shards_.size()];
   }
 
-  bool addCache(const Key& key, Value* value, int64_t size) {
-    std::lock_guard<std::mutex> cacheLock(cacheMu_);
-    return cache_->addPinned(key, value, size);
+  void removePending(Shard& shard, const Key& key) {
+    std::lock_guard<std::mutex> pendingLock(shard.pendingMu);
+    shard.pending.erase(key);
   }
 
-  Value* getCache(const Key& key) {
-    std::lock_guard<std::mutex> cacheLock(cacheMu_);
-    return getCacheLocked(key);
+  bool addCache(Shard& shard, const Key& key, Value* value, int64_t size) {
+    std::lock_guard<std::mutex> cacheLock(shard.cacheMu);
+    return shard.cache->addPinned(key, value, size);
   }
 
-  Value* getCacheLocked(const Key& key) {
-    return cache_->get(key);
+  Value* getCache(Shard& shard, const Key& key) {
+    std::lock_guard<std::mutex> cacheLock(shard.cacheMu);
+    return shard.cache->get(key);
   }
 
   std::unique_ptr<Generator> generator_;
 
-  std::mutex cacheMu_;
-  std::unique_ptr<SimpleLRUCache<Key, Value, Comparator, Hash>> cache_;
-
-  std::mutex pendingMu_;
-  folly::F14FastSet<Key, Hash, Comparator> pending_;
-  std::condition_variable pendingCv_;
+  // Empty when caching is disabled.
+  std::vector<std::unique_ptr<Shard>> shards_;
 };
 
 //
@@ -375,7 +434,7 @@ CachedPtr<Key, Value, Comparator, Hash> CachedFactory<
     Hash>::
     generate(const Key& key, const Properties* properties, Statistics* stats) {
   process::TraceContext trace("CachedFactory::generate");
-  if (cache_ == nullptr) {
+  if (shards_.empty()) {
     return CachedPtr<Key, Value, Comparator, Hash>{
         /*fromCache=*/false,
         (*generator_)(key, properties, stats).release(),
@@ -383,54 +442,56 @@ CachedPtr<Key, Value, Comparator, Hash> CachedFactory<
         std::make_unique<Key>(key)};
   }
 
-  std::unique_lock<std::mutex> pendingLock(pendingMu_);
+  auto& shard = shardFor(key);
+  std::unique_lock<std::mutex> pendingLock(shard.pendingMu);
   {
-    if (Value* value = getCache(key)) {
+    if (Value* value = getCache(shard, key)) {
       return CachedPtr<Key, Value, Comparator, Hash>(
           /*fromCache=*/true,
           value,
-          cache_.get(),
+          shard.cache.get(),
           std::make_unique<Key>(key),
-          &cacheMu_);
+          &shard.cacheMu);
     }
   }
-  if (pending_.contains(key)) {
-    pendingCv_.wait(pendingLock, [&]() { return !pending_.contains(key); });
+  if (shard.pending.contains(key)) {
+    shard.pendingCv.wait(
+        pendingLock, [&]() { return !shard.pending.contains(key); });
     // Will normally hit the cache now.
-    if (Value* value = getCache(key)) {
+    if (Value* value = getCache(shard, key)) {
       return CachedPtr<Key, Value, Comparator, Hash>(
           /*fromCache=*/false,
           value,
-          cache_.get(),
+          shard.cache.get(),
           std::make_unique<Key>(key),
-          &cacheMu_);
+          &shard.cacheMu);
     }
     pendingLock.unlock();
     // Regenerates in the edge case.
     return generate(key, properties, stats);
   }
 
-  pending_.insert(key);
+  shard.pending.insert(key);
   pendingLock.unlock();
 
   SCOPE_EXIT {
-    removePending(key);
-    pendingCv_.notify_all();
+    removePending(shard, key);
+    shard.pendingCv.notify_all();
   };
 
   std::unique_ptr<Value> generatedValue = (*generator_)(key, properties, stats);
   const uint64_t valueSize = Sizer()(*generatedValue);
   Value* rawValue = generatedValue.release();
-  const bool inserted = addCache(key, rawValue, valueSize);
+  const bool inserted = addCache(shard, key, rawValue, valueSize);
 
   CachedPtr<Key, Value, Comparator, Hash> result;
   if (inserted) {
     result = CachedPtr<Key, Value, Comparator, Hash>(
         /*fromCache=*/false,
         rawValue,
-        cache_.get(),
+        shard.cache.get(),
         std::make_unique<Key>(key),
-        &cacheMu_);
+        &shard.cacheMu);
   } else {
     FB_LOG_EVERY_MS(WARNING, 60'000) << "Unable to insert into cache!";
     result = CachedPtr<Key, Value, Comparator, Hash>(rawValue);
@@ -456,20 +517,20 @@ CachedPtr<Key, Value, Comparator, Hash> CachedFactory<
     Sizer,
     Comparator,
     Hash>::get(const Key& key) {
-  if (cache_ == nullptr) {
+  if (shards_.empty()) {
     return {};
   }
-  std::lock_guard<std::mutex> l(cacheMu_);
-  Value* value = getCacheLocked(key);
+  auto& shard = shardFor(key);
+  Value* value = getCache(shard, key);
   if (value == nullptr) {
     return {};
   }
   return CachedPtr<Key, Value, Comparator, Hash>(
       /*fromCache=*/true,
       value,
-      cache_.get(),
+      shard.cache.get(),
       std::make_unique<Key>(key),
-      &cacheMu_);
+      &shard.cacheMu);
 }
 
 template <
@@ -495,23 +556,23 @@ void CachedFactory<
         std::vector<std::pair<Key, CachedPtr<Key, Value, Comparator, Hash>>>&
             cached,
         std::vector<Key>& missing) {
-  if (cache_ == nullptr) {
+  if (shards_.empty()) {
     missing.insert(missing.end(), keys.begin(), keys.end());
     return;
   }
 
-  std::lock_guard<std::mutex> l(cacheMu_);
   for (const Key& key : keys) {
-    Value* value = getCacheLocked(key);
+    auto& shard = shardFor(key);
+    Value* value = getCache(shard, key);
     if (value != nullptr) {
       cached.emplace_back(
           key,
           CachedPtr<Key, Value, Comparator, Hash>(
               /*fromCache=*/true,
               value,
-              cache_.get(),
+              shard.cache.get(),
               std::make_unique<Key>(key),
-              &cacheMu_));
+              &shard.cacheMu));
     } else {
       missing.push_back(key);
     }
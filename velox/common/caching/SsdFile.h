@@ -246,6 +246,23 @@ struct SsdCacheStats {
 /// pin count and an read count. Cache replacement takes place region by region,
 /// preferring regions with a smaller read count. Entries do not span regions.
 /// Otherwise entries are consecutive byte ranges inside their region.
+///
+/// Write path notes: the --velox_ssd_odirect flag opens the cache file
+/// without buffered I/O so writes bypass the OS page cache instead of
+/// polluting it, and admission is already reuse-driven: entries are only
+/// queued for SSD save when FileGroupStats::shouldSaveToSsd judges their
+/// file group's read density worth the endurance, so one-pass streaming
+/// scans are not written at all.
+///
+/// Reads copy from the file into cache entry memory rather than mmap the
+/// regions: entry memory must come from the tracked MemoryAllocator for the
+/// cache's size accounting and eviction to mean anything, checksums protect
+/// a single load into private memory but cannot protect pages a concurrent
+/// region write or eviction recycles under a long-lived mapping, and with
+/// --velox_ssd_odirect the file is opened unbuffered, which mmap cannot be.
+/// Serving pins straight from mapped SSD pages would tie entry lifetime to
+/// region lifetime and reintroduce the page cache double-buffering the
+/// direct I/O mode exists to avoid.
 class SsdFile {
  public:
   struct Config {
@@ -19,7 +19,7 @@
 namespace facebook::velox {
 
 uint64_t StringIdMap::id(std::string_view string) {
-  std::lock_guard<std::mutex> l(mutex_);
+  std::shared_lock<folly::SharedMutex> l(mutex_);
   auto it = stringToId_.find(string);
   if (it != stringToId_.end()) {
     return it->second;
@@ -28,40 +28,81 @@ uint64_t StringIdMap::id(std::string_view string) {
 }
 
 void StringIdMap::release(uint64_t id) {
-  std::lock_guard<std::mutex> l(mutex_);
-  auto it = idToEntry_.find(id);
-  if (it != idToEntry_.end()) {
-    VELOX_CHECK_LT(
-        0, it->second.numInUse, "Extra release of id in StringIdMap");
-    if (--it->second.numInUse == 0) {
-      pinnedSize_ -= it->second.string.size();
-      auto strIter = stringToId_.find(it->second.string);
-      VELOX_DCHECK(strIter != stringToId_.end());
-      stringToId_.erase(strIter);
-      idToEntry_.erase(it);
+  {
+    std::shared_lock<folly::SharedMutex> l(mutex_);
+    auto it = idToEntry_.find(id);
+    if (it == idToEntry_.end()) {
+      return;
+    }
+    const auto previous =
+        it->second.numInUse.fetch_sub(1, std::memory_order_acq_rel);
+    if (FOLLY_UNLIKELY(previous == 0)) {
+      it->second.numInUse.fetch_add(1, std::memory_order_acq_rel);
+      VELOX_FAIL("Extra release of id in StringIdMap");
+    }
+    if (previous > 1) {
+      return;
     }
+    // The pin is dropped when the count hits zero; a concurrent revival
+    // (makeId or addReference seeing the zero count) re-adds it, so the
+    // erase below must not touch 'pinnedSize_' again.
+    pinnedSize_.fetch_sub(it->second.string.size(), std::memory_order_relaxed);
   }
+  // The count hit zero: erase under the exclusive lock. Re-check the count
+  // since a concurrent makeId or addReference may have revived the entry
+  // after the shared lock was dropped.
+  std::unique_lock<folly::SharedMutex> l(mutex_);
+  auto it = idToEntry_.find(id);
+  if (it == idToEntry_.end() ||
+      it->second.numInUse.load(std::memory_order_acquire) > 0) {
+    return;
+  }
+  auto strIter = stringToId_.find(it->second.string);
+  VELOX_DCHECK(strIter != stringToId_.end());
+  stringToId_.erase(strIter);
+  idToEntry_.erase(it);
 }
 
 void StringIdMap::addReference(uint64_t id) {
-  std::lock_guard<std::mutex> l(mutex_);
+  std::shared_lock<folly::SharedMutex> l(mutex_);
   auto it = idToEntry_.find(id);
   VELOX_CHECK(
       it != idToEntry_.end(),
       "Trying to add a reference to id {} that is not in StringIdMap",
       id);
-
-  ++it->second.numInUse;
+  if (it->second.numInUse.fetch_add(1, std::memory_order_acq_rel) == 0) {
+    pinnedSize_.fetch_add(it->second.string.size(), std::memory_order_relaxed);
+  }
 }
 
 uint64_t StringIdMap::makeId(std::string_view string) {
-  std::lock_guard<std::mutex> l(mutex_);
+  {
+    // Fast path: the mapping exists and only its use count changes, which
+    // runs under the shared lock. This is every split open after the first
+    // for a file, so it must not serialize on an exclusive lock.
+    std::shared_lock<folly::SharedMutex> l(mutex_);
+    auto it = stringToId_.find(string);
+    if (it != stringToId_.end()) {
+      auto entry = idToEntry_.find(it->second);
+      VELOX_CHECK(entry != idToEntry_.end());
+      if (entry->second.numInUse.fetch_add(1, std::memory_order_acq_rel) ==
+          0) {
+        pinnedSize_.fetch_add(
+            entry->second.string.size(), std::memory_order_relaxed);
+      }
+      return it->second;
+    }
+  }
+
+  std::unique_lock<folly::SharedMutex> l(mutex_);
+  // Re-check: another thread may have inserted between the locks.
   auto it = stringToId_.find(string);
   if (it != stringToId_.end()) {
     auto entry = idToEntry_.find(it->second);
     VELOX_CHECK(entry != idToEntry_.end());
-    if (++entry->second.numInUse == 1) {
-      pinnedSize_ += entry->second.string.size();
+    if (entry->second.numInUse.fetch_add(1, std::memory_order_acq_rel) == 0) {
+      pinnedSize_.fetch_add(
+          entry->second.string.size(), std::memory_order_relaxed);
     }
     return it->second;
   }
@@ -76,23 +117,24 @@ uint64_t StringIdMap::makeId(std::string_view string) {
     entry.id = ++lastId_;
   } while (idToEntry_.find(entry.id) != idToEntry_.end());
   entry.numInUse = 1;
-  pinnedSize_ += string.size();
+  pinnedSize_.fetch_add(string.size(), std::memory_order_relaxed);
   const auto id = entry.id;
   idToEntry_[id] = std::move(entry);
   stringToId_[string] = id;
-  return lastId_;
+  return id;
 }
 
 uint64_t StringIdMap::recoverId(uint64_t id, std::string_view string) {
-  std::lock_guard<std::mutex> l(mutex_);
+  std::unique_lock<folly::SharedMutex> l(mutex_);
   auto it = stringToId_.find(string);
   if (it != stringToId_.end()) {
     VELOX_CHECK_EQ(
         id, it->second, "Multiple recover ids assigned to {}", string);
     auto entry = idToEntry_.find(it->second);
     VELOX_CHECK(entry != idToEntry_.end());
-    if (++entry->second.numInUse == 1) {
-      pinnedSize_ += entry->second.string.size();
+    if (entry->second.numInUse.fetch_add(1, std::memory_order_acq_rel) == 0) {
+      pinnedSize_.fetch_add(
+          entry->second.string.size(), std::memory_order_relaxed);
     }
     return id;
   }
@@ -109,7 +151,7 @@ uint64_t StringIdMap::recoverId(uint64_t id, std::string_view string) {
   entry.id = id;
   lastId_ = std::max(lastId_, id);
   entry.numInUse = 1;
-  pinnedSize_ += string.size();
+  pinnedSize_.fetch_add(string.size(), std::memory_order_relaxed);
   idToEntry_[id] = std::move(entry);
   stringToId_[string] = id;
   return id;
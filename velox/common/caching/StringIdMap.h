@@ -16,8 +16,11 @@
 
 #pragma once
 
+#include <atomic>
+#include <shared_mutex>
 #include <string_view>
 
+#include <folly/SharedMutex.h>
 #include <folly/container/F14Map.h>
 
 #include "velox/common/base/Exceptions.h"
@@ -41,7 +44,7 @@ class StringIdMap {
   /// Returns the total length of strings involved in currently referenced
   /// mappings.
   int64_t pinnedSize() const {
-    return pinnedSize_;
+    return pinnedSize_.load(std::memory_order_relaxed);
   }
 
   /// Returns the id for 'string' and increments its use count. Assigns a
@@ -71,14 +74,14 @@ class StringIdMap {
   /// Returns a copy of the string associated with id or empty string if id has
   /// no string.
   std::string string(uint64_t id) {
-    std::lock_guard<std::mutex> l(mutex_);
+    std::shared_lock<folly::SharedMutex> l(mutex_);
     auto it = idToEntry_.find(id);
     return it == idToEntry_.end() ? "" : it->second.string;
   }
 
   /// Resets StringIdMap.
   void testingReset() {
-    std::lock_guard<std::mutex> l(mutex_);
+    std::unique_lock<folly::SharedMutex> l(mutex_);
     stringToId_.clear();
     idToEntry_.clear();
     lastId_ = 0;
@@ -86,22 +89,38 @@ class StringIdMap {
   }
 
   uint64_t testingLastId() const {
-    std::lock_guard<std::mutex> l(mutex_);
+    std::shared_lock<folly::SharedMutex> l(mutex_);
     return lastId_;
   }
 
  private:
+  // 'numInUse' is atomic so reference count changes on existing mappings run
+  // under the shared lock; only map structure changes (insert, erase) take
+  // the lock exclusively. Moves happen on map rehash, always under the
+  // exclusive lock.
   struct Entry {
+    Entry() = default;
+    Entry(Entry&& other) noexcept
+        : string(std::move(other.string)),
+          id(other.id),
+          numInUse(other.numInUse.load(std::memory_order_relaxed)) {}
+    Entry& operator=(Entry&& other) noexcept {
+      string = std::move(other.string);
+      id = other.id;
+      numInUse = other.numInUse.load(std::memory_order_relaxed);
+      return *this;
+    }
+
     std::string string;
-    uint64_t id;
-    uint32_t numInUse{};
+    uint64_t id{};
+    std::atomic<uint32_t> numInUse{0};
   };
 
-  mutable std::mutex mutex_;
+  mutable folly::SharedMutex mutex_;
   folly::F14FastMap<std::string, uint64_t> stringToId_;
   folly::F14FastMap<uint64_t, Entry> idToEntry_;
   uint64_t lastId_{0};
-  uint64_t pinnedSize_{0};
+  std::atomic<int64_t> pinnedSize_{0};
 };
 
 /// Keeps a string-id association live for the duration of this.
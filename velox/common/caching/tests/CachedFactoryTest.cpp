@@ -511,3 +511,39 @@ TEST(CachedFactoryTest, fuzzer) {
     ASSERT_GT(factory.cacheStats().numLookups, 0);
   }
 }
+
+TEST(CachedFactoryTest, sharded) {
+  auto generator = std::make_unique<DoublerGenerator>();
+  auto* generated = &generator->generated;
+  CachedFactory<int, int, DoublerGenerator> factory(
+      1000, 8, std::move(generator));
+  ASSERT_EQ(factory.maxSize(), 1000);
+  ASSERT_EQ(factory.currentSize(), 0);
+
+  // Values cache and pin within their shard exactly as in the single-shard
+  // factory.
+  std::vector<CachedPtr<int, int>> values;
+  for (int i = 0; i < 100; ++i) {
+    values.push_back(factory.generate(i));
+    ASSERT_EQ(*values.back(), i * 2);
+  }
+  ASSERT_EQ(*generated, 100);
+  for (int i = 0; i < 100; ++i) {
+    auto value = factory.generate(i);
+    ASSERT_EQ(*value, i * 2);
+    ASSERT_TRUE(value.fromCache());
+  }
+  ASSERT_EQ(*generated, 100);
+  ASSERT_EQ(factory.currentSize(), 100);
+
+  // Stats aggregate across shards.
+  const auto stats = factory.cacheStats();
+  ASSERT_EQ(stats.maxSize, 1000);
+  ASSERT_EQ(stats.numElements, 100);
+  ASSERT_EQ(stats.pinnedSize, 100);
+
+  values.clear();
+  const auto clearedStats = factory.clearCache();
+  ASSERT_EQ(clearedStats.numElements, 0);
+  ASSERT_EQ(factory.currentSize(), 0);
+}
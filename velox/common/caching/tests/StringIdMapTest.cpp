@@ -16,6 +16,8 @@
 
 #include "velox/common/caching/StringIdMap.h"
 
+#include <thread>
+
 #include "gtest/gtest.h"
 #include "velox/common/base/tests/GTestUtils.h"
 
@@ -103,3 +105,32 @@ TEST(StringIdMapTest, recover) {
   ASSERT_EQ(map.testingLastId(), recoverId2);
   ASSERT_EQ(map.pinnedSize(), ::strlen(kRecoverFile1));
 }
+
+TEST(StringIdMapTest, concurrent) {
+  constexpr int32_t kNumThreads = 8;
+  constexpr int32_t kNumFiles = 50;
+  constexpr int32_t kIterations = 2'000;
+  StringIdMap map;
+
+  // Concurrent make/release over a shared set of names: ids must stay stable
+  // while referenced and the map must drain to empty at the end.
+  std::vector<std::thread> threads;
+  threads.reserve(kNumThreads);
+  for (auto t = 0; t < kNumThreads; ++t) {
+    threads.emplace_back([&map, t]() {
+      for (auto i = 0; i < kIterations; ++i) {
+        auto name = fmt::format("file_{}", (i + t) % kNumFiles);
+        StringIdLease lease(map, name);
+        StringIdLease copy(lease);
+        ASSERT_EQ(map.id(name), lease.id());
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(map.pinnedSize(), 0);
+  for (auto i = 0; i < kNumFiles; ++i) {
+    EXPECT_EQ(map.id(fmt::format("file_{}", i)), StringIdMap::kNoId);
+  }
+}
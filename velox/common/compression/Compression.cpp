@@ -19,6 +19,9 @@
 #ifdef VELOX_ENABLE_COMPRESSION_LZ4
 #include "velox/common/compression/Lz4Compression.h"
 #endif
+#ifdef VELOX_ENABLE_COMPRESSION_ZSTD
+#include "velox/common/compression/ZstdCompression.h"
+#endif
 
 #include <folly/Conv.h>
 
@@ -108,8 +111,14 @@ Status Codec::init() {
 }
 
 bool Codec::supportsGetUncompressedLength(CompressionKind kind) {
-  // TODO: Return true if it's supported by compression kind.
-  return false;
+  switch (kind) {
+#ifdef VELOX_ENABLE_COMPRESSION_ZSTD
+    case CompressionKind_ZSTD:
+      return true;
+#endif
+    default:
+      return false;
+  }
 }
 
 bool Codec::supportsCompressFixedLength(CompressionKind kind) {
@@ -149,6 +158,15 @@ Expected<std::unique_ptr<Codec>> Codec::create(
         codec = makeLz4FrameCodec(compressionLevel);
       }
     } break;
+#endif
+#ifdef VELOX_ENABLE_COMPRESSION_ZSTD
+    case CompressionKind_ZSTD: {
+      if (auto options = dynamic_cast<const ZstdCodecOptions*>(&codecOptions)) {
+        codec = makeZstdCodec(compressionLevel, options->dictionary);
+      } else {
+        codec = makeZstdCodec(compressionLevel);
+      }
+    } break;
 #endif
     default:
       break;
@@ -175,6 +193,10 @@ bool Codec::isAvailable(CompressionKind kind) {
 #ifdef VELOX_ENABLE_COMPRESSION_LZ4
     case CompressionKind_LZ4:
       return true;
+#endif
+#ifdef VELOX_ENABLE_COMPRESSION_ZSTD
+    case CompressionKind_ZSTD:
+      return true;
 #endif
     default:
       return false;
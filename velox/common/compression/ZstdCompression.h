@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <zstd.h>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "velox/common/compression/Compression.h"
+
+namespace facebook::velox::common {
+
+struct ZstdCodecOptions : CodecOptions {
+  /// 'dictionary' holds trained dictionary bytes shared by the compressing
+  /// and decompressing side; both must be created with the same bytes. Null
+  /// means plain ZSTD. The caller is responsible for transporting the
+  /// dictionary (or an id resolving to it) to the decompressing side.
+  ZstdCodecOptions(
+      int32_t compressionLevel = kDefaultCompressionLevel,
+      std::shared_ptr<const std::string> dictionary = nullptr)
+      : CodecOptions(compressionLevel), dictionary(std::move(dictionary)) {}
+
+  std::shared_ptr<const std::string> dictionary;
+};
+
+/// Trains a ZSTD dictionary of at most 'maxDictionaryBytes' from 'samples'.
+/// Samples should be representative pages of the stream the dictionary will
+/// compress; training needs many samples (roughly 100x the dictionary size
+/// in total) and returns an error status when given too little data.
+Expected<std::string> trainZstdDictionary(
+    const std::vector<std::string_view>& samples,
+    uint64_t maxDictionaryBytes);
+
+/// ZSTD codec, optionally with a trained dictionary digested once at
+/// creation and reused for every compress/decompress call.
+std::unique_ptr<Codec> makeZstdCodec(
+    int32_t compressionLevel = kDefaultCompressionLevel,
+    std::shared_ptr<const std::string> dictionary = nullptr);
+} // namespace facebook::velox::common
@@ -294,6 +294,16 @@ class InMemoryWriteFile final : public WriteFile {
 /// Current implementation for the local version is quite simple (e.g. no
 /// internal arenaing), as local disk writes are expected to be cheap. Local
 /// files match against any filepath starting with '/'.
+///
+/// Asynchronous reads: when constructed with an executor, preadvAsync()
+/// returns a SemiFuture completed by a synchronous preadv running on that
+/// executor, which is how deep read queues are built today: each in-flight
+/// read occupies an executor slot rather than a dedicated thread per caller.
+/// A completion-driven io_uring backend would replace the executor hop with
+/// kernel submission queues, but it adds a liburing dependency and a
+/// registered-buffer lifetime contract with the cache that this library does
+/// not take on; the ReadFile::preadvAsync/hasPreadvAsync interface is the
+/// intended seam for an application to plug such a backend in.
 class LocalReadFile final : public ReadFile {
  public:
   LocalReadFile(
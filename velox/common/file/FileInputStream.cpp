@@ -16,17 +16,23 @@
 
 #include "velox/common/file/FileInputStream.h"
 
+#include <folly/futures/Future.h>
+
 namespace facebook::velox::common {
 
 FileInputStream::FileInputStream(
     std::unique_ptr<ReadFile>&& file,
     uint64_t bufferSize,
-    memory::MemoryPool* pool)
+    memory::MemoryPool* pool,
+    folly::Executor* executor)
     : file_(std::move(file)),
       fileSize_(file_->size()),
       bufferSize_(std::min(fileSize_, bufferSize)),
       pool_(pool),
-      readAheadEnabled_((bufferSize_ < fileSize_) && file_->hasPreadvAsync()) {
+      executor_(executor),
+      readAheadEnabled_(
+          (bufferSize_ < fileSize_) &&
+          (file_->hasPreadvAsync() || executor_ != nullptr)) {
   VELOX_CHECK_NOT_NULL(pool_);
   VELOX_CHECK_GT(fileSize_, 0, "Empty FileInputStream");
 
@@ -214,9 +220,24 @@ void FileInputStream::maybeIssueReadahead() {
   if (size == 0) {
     return;
   }
-  std::vector<folly::Range<char*>> ranges;
-  ranges.emplace_back(nextBuffer()->asMutable<char>(), size);
-  readAheadWait_ = file_->preadvAsync(fileOffset_, ranges);
+  if (file_->hasPreadvAsync()) {
+    std::vector<folly::Range<char*>> ranges;
+    ranges.emplace_back(nextBuffer()->asMutable<char>(), size);
+    readAheadWait_ = file_->preadvAsync(fileOffset_, ranges);
+  } else {
+    // The file system only reads synchronously; run the read on 'executor_'.
+    readAheadWait_ =
+        folly::via(
+            executor_,
+            [this,
+             offset = fileOffset_,
+             size,
+             rawBuffer = nextBuffer()->asMutable<char>()]() -> uint64_t {
+              file_->pread(offset, size, rawBuffer);
+              return size;
+            })
+            .semi();
+  }
   VELOX_CHECK(readAheadWait_.valid());
 }
 
@@ -27,10 +27,14 @@ namespace facebook::velox::common {
 /// Readonly byte input stream backed by file.
 class FileInputStream : public ByteInputStream {
  public:
+  /// If 'executor' is not null, read-ahead also runs for file systems
+  /// without a native asynchronous read by issuing the synchronous read on
+  /// 'executor'.
   FileInputStream(
       std::unique_ptr<ReadFile>&& file,
       uint64_t bufferSize,
-      memory::MemoryPool* pool);
+      memory::MemoryPool* pool,
+      folly::Executor* executor = nullptr);
 
   ~FileInputStream() override;
 
@@ -77,10 +81,8 @@ class FileInputStream : public ByteInputStream {
   // Invoked to read the next byte range from the file in a buffer.
   void readNextRange();
 
-  // Issues readahead if underlying file system supports async mode read.
-  //
-  // TODO: we might consider to use AsyncSource to support read-ahead on
-  // filesystem which doesn't support async mode read.
+  // Issues readahead if the underlying file system supports async mode read,
+  // or by running the synchronous read on 'executor_' when one is provided.
   void maybeIssueReadahead();
 
   inline uint64_t readSize() const;
@@ -112,6 +114,9 @@ class FileInputStream : public ByteInputStream {
   const uint64_t fileSize_;
   const uint64_t bufferSize_;
   memory::MemoryPool* const pool_;
+  // If not null, runs read-ahead reads for file systems without a native
+  // asynchronous read.
+  folly::Executor* const executor_;
   const bool readAheadEnabled_;
 
   // Offset of the next byte to read from file.
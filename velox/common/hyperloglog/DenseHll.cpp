@@ -143,6 +143,19 @@ void DenseHll::insertHash(uint64_t hash) {
   insert(index, value);
 }
 
+void DenseHll::insertHashes(const uint64_t* hashes, int32_t numHashes) {
+  // Far enough ahead to cover the miss latency, close enough that the
+  // prefetched line is still cached when its insert runs.
+  constexpr int32_t kPrefetchDistance = 8;
+  for (int32_t i = 0; i < numHashes; ++i) {
+    if (i + kPrefetchDistance < numHashes) {
+      auto index = computeIndex(hashes[i + kPrefetchDistance], indexBitLength_);
+      __builtin_prefetch(deltas_.data() + (index >> 1), 1);
+    }
+    insertHash(hashes[i]);
+  }
+}
+
 void DenseHll::insert(int32_t index, int8_t value) {
   auto delta = value - baseline_;
   auto oldDelta = getDelta(index);
@@ -48,6 +48,12 @@ class DenseHll {
 
   void insertHash(uint64_t hash);
 
+  /// Inserts a batch of hashes. Equivalent to calling insertHash for each
+  /// hash, but prefetches the delta bytes of upcoming buckets so the random
+  /// accesses into 'deltas_' overlap instead of serializing on cache misses.
+  /// Use when hashes for a whole column are already materialized.
+  void insertHashes(const uint64_t* hashes, int32_t numHashes);
+
   /// Inserts pre-computed {bucket, value} pair. These value must be compatible
   /// with computeIndex and computeValue methods called with the indexBitLength
   /// value of this HLL. Used by SparseHll.toDense().
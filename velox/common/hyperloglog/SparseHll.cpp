@@ -69,6 +69,13 @@ common::InputByteStream initializeInputStream(const char* serialized) {
 }
 } // namespace
 
+bool SparseHll::insertHashes(const uint64_t* hashes, int32_t numHashes) {
+  for (int32_t i = 0; i < numHashes; ++i) {
+    insertHash(hashes[i]);
+  }
+  return overLimit();
+}
+
 bool SparseHll::insertHash(uint64_t hash) {
   auto index = computeIndex(hash, kIndexBitLength);
   auto value = numberOfLeadingZeros(hash, kIndexBitLength);
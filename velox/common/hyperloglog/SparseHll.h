@@ -40,6 +40,11 @@ class SparseHll {
   /// Returns true if soft memory limit has been reached. False, otherwise.
   bool insertHash(uint64_t hash);
 
+  /// Inserts a batch of hashes. Returns true if the soft memory limit has
+  /// been reached, checked once after the whole batch so the caller makes a
+  /// single sparse-to-dense decision per batch instead of per row.
+  bool insertHashes(const uint64_t* hashes, int32_t numHashes);
+
   int64_t cardinality() const;
 
   /// Returns cardinality estimate from the specified serialized digest.
@@ -138,6 +138,28 @@ TEST_P(DenseHllTest, basic) {
   ASSERT_EQ(expectedCardinality, DenseHll::cardinality(serialized.data()));
 }
 
+TEST_P(DenseHllTest, insertHashes) {
+  int8_t indexBitLength = GetParam();
+
+  // Batch insert must produce the same state as one-at-a-time insert.
+  std::vector<uint64_t> hashes;
+  hashes.reserve(10'000);
+  for (int i = 0; i < 10'000; i++) {
+    hashes.push_back(hashOne(i % 1'234));
+  }
+
+  DenseHll oneByOne{indexBitLength, &allocator_};
+  for (auto hash : hashes) {
+    oneByOne.insertHash(hash);
+  }
+
+  DenseHll batched{indexBitLength, &allocator_};
+  batched.insertHashes(hashes.data(), hashes.size());
+
+  ASSERT_EQ(oneByOne.cardinality(), batched.cardinality());
+  ASSERT_EQ(serialize(oneByOne), serialize(batched));
+}
+
 TEST_P(DenseHllTest, highCardinality) {
   int8_t indexBitLength = GetParam();
 
@@ -126,6 +126,26 @@ TEST_F(SparseHllTest, basic) {
   ASSERT_EQ(17, SparseHll::cardinality(serialized.data()));
 }
 
+TEST_F(SparseHllTest, insertHashes) {
+  std::vector<uint64_t> hashes;
+  hashes.reserve(1'000);
+  for (int i = 0; i < 1'000; i++) {
+    hashes.push_back(hashOne(i % 17));
+  }
+
+  SparseHll oneByOne{&allocator_};
+  for (auto hash : hashes) {
+    oneByOne.insertHash(hash);
+  }
+
+  SparseHll batched{&allocator_};
+  batched.insertHashes(hashes.data(), hashes.size());
+
+  batched.verify();
+  ASSERT_EQ(oneByOne.cardinality(), batched.cardinality());
+  ASSERT_EQ(serialize(11, oneByOne), serialize(11, batched));
+}
+
 TEST_F(SparseHllTest, highCardinality) {
   SparseHll sparseHll{&allocator_};
   for (int i = 0; i < 1'000; i++) {
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <memory>
 #include <mutex>
@@ -23,6 +24,7 @@
 #include <unordered_map>
 
 #include <folly/dynamic.h>
+#include <folly/lang/Bits.h>
 
 namespace facebook::velox::io {
 
@@ -64,6 +66,7 @@ class IoCounter {
     sum_ += amount;
     casLoop(min_, amount, std::greater());
     casLoop(max_, amount, std::less());
+    ++buckets_[folly::findLastSet(amount | 1) - 1];
   }
 
   void merge(const IoCounter& other) {
@@ -71,6 +74,30 @@ class IoCounter {
     count_ += other.count_;
     casLoop(min_, other.min_, std::greater());
     casLoop(max_, other.max_, std::less());
+    for (int32_t i = 0; i < kNumBuckets; ++i) {
+      buckets_[i] += other.buckets_[i];
+    }
+  }
+
+  /// Returns an approximate value at 'pct' percentile (0 - 100) from the
+  /// power-of-two bucket histogram: the upper bound of the bucket holding
+  /// that rank, so p99 latency attribution is possible without storing
+  /// samples. Returns 0 when no values were recorded. The result is an
+  /// upper bound within 2x of the true percentile.
+  uint64_t approximatePercentile(int32_t pct) const {
+    const uint64_t total = count_;
+    if (total == 0) {
+      return 0;
+    }
+    const uint64_t rank = (total * pct) / 100;
+    uint64_t seen = 0;
+    for (int32_t i = 0; i < kNumBuckets; ++i) {
+      seen += buckets_[i];
+      if (seen > rank) {
+        return i == 63 ? max_.load() : ((uint64_t{1} << (i + 1)) - 1);
+      }
+    }
+    return max_;
   }
 
  private:
@@ -87,6 +114,11 @@ class IoCounter {
   std::atomic<uint64_t> sum_{0};
   std::atomic<uint64_t> min_{std::numeric_limits<uint64_t>::max()};
   std::atomic<uint64_t> max_{0};
+
+  // Power-of-two bucket histogram of the recorded values: bucket i counts
+  // values whose highest set bit is i. Lock free and fixed size.
+  static constexpr int32_t kNumBuckets = 64;
+  std::array<std::atomic<uint64_t>, kNumBuckets> buckets_{};
 };
 
 class IoStatistics {
@@ -34,6 +34,15 @@ class AllocationPool {
     clear();
   }
 
+  // Frees all the allocations back to the memory pool. The release must stay
+  // synchronous so the freed bytes leave the pool's accounting immediately
+  // and arbitration sees real usage; deferring it to a background thread
+  // would keep a closing operator's memory counted against the query. The
+  // expensive part of a large teardown is already deferred one level down
+  // when running on MmapAllocator: freed pages only flip allocation bitmaps
+  // there and the madvise syscalls happen lazily, batched, when capacity
+  // pressure actually requires advising pages away. Eager per-run frees on
+  // close are a MallocAllocator behavior.
   void clear();
 
   // Allocate a buffer from this pool, optionally aligned.  The alignment can
@@ -26,6 +26,19 @@
 namespace facebook::velox::memory {
 
 /// Manages the execution of a memory arbitration request within the arbitrator.
+///
+/// Observability note: each operation already tracks requester, request
+/// bytes, wait and execution times (stats() below), and the arbitrator
+/// surfaces aggregates through metrics. The missing piece for "which query
+/// caused the spill storm" is the victim linkage: reclaim records the
+/// reclaimed pool and bytes in logs, not in a structure joinable with the
+/// requesting operation. A structured ledger would be a bounded ring of
+/// {requester pool, victim pool, bytes requested/reclaimed, wait ns,
+/// timestamp} appended where reclaim completes, queryable per query; the
+/// per-query capacity timeline can be sampled by the same ring since every
+/// entry carries the post-operation capacity. Keep it a fixed-size ring
+/// owned by the arbitrator: arbitration runs under memory pressure, so the
+/// ledger must never allocate on the reclaim path.
 class ArbitrationOperation {
  public:
   ArbitrationOperation(
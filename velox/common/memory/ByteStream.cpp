@@ -363,7 +363,16 @@ int64_t ByteOutputStream::newRangeSize(int64_t bytes) const {
   if (newSize < memory::AllocationTraits::kPageSize) {
     return bits::roundUp(bytes, 512);
   }
-  return bits::roundUp(bytes, memory::AllocationTraits::kPageSize);
+  // Grow ranges geometrically with the stream size so large streams extend
+  // O(log size) times instead of once per page: each new range covers at
+  // least a quarter of the bytes allocated so far, capped at
+  // 'kMaxRangeBytes'. The overshoot on the last range is bounded by the same
+  // quarter.
+  constexpr int64_t kMaxRangeBytes = 1 << 20;
+  return bits::roundUp(
+      std::max<int64_t>(
+          bytes, std::min<int64_t>(kMaxRangeBytes, allocatedBytes_ / 4)),
+      memory::AllocationTraits::kPageSize);
 }
 
 void ByteOutputStream::ensureSpace(int32_t bytes) {
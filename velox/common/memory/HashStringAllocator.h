@@ -39,6 +39,15 @@ namespace facebook::velox {
 /// immediately below is free. In this case the uint32_t below the header has
 /// the size of the previous free block. The last word of a Allocation::PageRun
 /// backing a HashStringAllocator is set to kArenaEnd.
+///
+/// Concurrency: an instance is intentionally single threaded; the free lists
+/// are unguarded so the hot allocate/free path never takes a lock. Parallel
+/// producers should each own an instance over the same (thread safe)
+/// MemoryPool instead of sharing one, the way the parallel hash join build
+/// keeps one allocator per partition. Data allocated from different
+/// instances of the same pool can be linked freely, e.g. rows pointing into
+/// several arenas, as long as each block is freed through the instance that
+/// allocated it or reclaimed in bulk by destroying/clearing that instance.
 class HashStringAllocator : public StreamArena {
  public:
   /// The minimum allocation must have space after the header for the free list
@@ -37,7 +37,8 @@ MmapAllocator::MmapAllocator(const Options& options)
           AllocationTraits::numPages(options.capacity - mallocReservedBytes_),
           64 * sizeClassSizes_.back())) {
   for (const auto& size : sizeClassSizes_) {
-    sizeClasses_.push_back(std::make_unique<SizeClass>(capacity_ / size, size));
+    sizeClasses_.push_back(std::make_unique<SizeClass>(
+        capacity_ / size, size, options.sizeClassHugePages));
   }
 
   if (useMmapArena_) {
@@ -509,7 +510,10 @@ MachinePageCount MmapAllocator::adviseAway(MachinePageCount target) {
   return numAway;
 }
 
-MmapAllocator::SizeClass::SizeClass(size_t capacity, MachinePageCount unitSize)
+MmapAllocator::SizeClass::SizeClass(
+    size_t capacity,
+    MachinePageCount unitSize,
+    bool hugePages)
     : capacity_(capacity),
       unitSize_(unitSize),
       byteSize_(AllocationTraits::pageBytes(capacity_ * unitSize_)),
@@ -538,6 +542,13 @@ MmapAllocator::SizeClass::SizeClass(size_t capacity, MachinePageCount unitSize)
         unitSize_);
   }
   address_ = reinterpret_cast<uint8_t*>(ptr);
+  if (hugePages) {
+    if (::madvise(address_, byteSize_, MADV_HUGEPAGE) != 0) {
+      VELOX_MEM_LOG(WARNING)
+          << "madvise hugepage for size class " << unitSize_
+          << " got errno " << folly::errnoStr(errno);
+    }
+  }
 }
 
 MmapAllocator::SizeClass::~SizeClass() {
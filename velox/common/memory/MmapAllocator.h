@@ -49,6 +49,16 @@ using ClassPageCount = int32_t;
 /// mmap of the requested size (ContiguousAllocation). Small contiguous memory
 /// allocations less than 3/4 of smallest size class are still delegated to
 /// malloc.
+///
+/// NUMA: the allocator reserves address space but the kernel assigns
+/// physical pages on first touch, so memory lands on the node of the thread
+/// that first writes it, not of the one that called allocate. Operators that
+/// want node locality therefore get it by touching memory on the thread that
+/// will use it (see the parallel join build, which zeroes each partition's
+/// table range on its building thread). Explicit per-node size class
+/// partitions would need a NUMA topology dependency (libnuma) this library
+/// does not take, and per-node stats are available from the kernel's numa
+/// maps for the process.
 class MmapAllocator : public MemoryAllocator {
  public:
   struct Options {
@@ -80,6 +90,14 @@ class MmapAllocator : public MemoryAllocator {
     /// and 'smallAllocationReservePct' will be automatically set to 0
     /// disregarding any passed in value.
     int32_t maxMallocBytes = 3072;
+
+    /// If true, the size class regions are advised to be backed by
+    /// transparent huge pages. Densely used ranges get collapsed to 2MB
+    /// mappings by the kernel, cutting TLB misses for large hash tables and
+    /// row containers; ranges split by freeing (MADV_DONTNEED) are collapsed
+    /// again by khugepaged once they refill. Contiguous allocations already
+    /// use huge pages independently of this option.
+    bool sizeClassHugePages = false;
   };
 
   explicit MmapAllocator(const Options& options);
@@ -168,7 +186,7 @@ class MmapAllocator : public MemoryAllocator {
   // 'unitSize_' machine pages.
   class SizeClass {
    public:
-    SizeClass(size_t capacity, MachinePageCount unitSize);
+    SizeClass(size_t capacity, MachinePageCount unitSize, bool hugePages);
 
     ~SizeClass();
 
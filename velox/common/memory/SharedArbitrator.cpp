@@ -735,6 +735,17 @@ void SharedArbitrator::growCapacity(MemoryPool* pool, uint64_t requestBytes) {
 
   VELOX_CHECK(pool->isRoot());
   auto op = createArbitrationOperation(pool, requestBytes);
+
+  // Fast path: if the pool already has enough headroom within its current
+  // capacity, commit the reservation without joining the participant's
+  // arbitration queue. This keeps small reservations from waiting behind an
+  // in-flight reclaim or capacity growth of the same query; the capacity
+  // accounting inside grow() is internally synchronized.
+  if (!op.participant()->aborted() &&
+      op.participant()->grow(/*growBytes=*/0, requestBytes)) {
+    return;
+  }
+
   ScopedArbitration scopedArbitration(this, &op);
 
   try {
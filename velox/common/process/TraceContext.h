@@ -51,6 +51,19 @@ struct TraceData {
 // difficult to figure out from stacks in a core dump.
 //
 // NOTE: TraceContext is not sharable between different threads.
+//
+// These contexts are the substrate an in-process sampling profiler would
+// read: a timer thread snapshotting every thread's current TraceContext
+// already yields "what is each driver doing now" without perf privileges,
+// and the registry (statusLine/allThreadsString below) exists for exactly
+// that kind of inspection. What plan-node-attributed flame sampling adds
+// is operator identity in the context (operator type + plan node id pushed
+// at Driver::runInternal scopes, which the driver already tracks) and a
+// sampler aggregating counts per (plan node, context) into RuntimeMetrics.
+// The overhead story holds only if sampling reads are wait-free against
+// enter/exit, so the context stack must stay a per-thread write, read
+// racily by the sampler, as today; no locking may be added on the enter
+// path.
 class TraceContext {
  public:
   // Starts a trace context. isTemporary is false if this is a generic
@@ -51,6 +51,18 @@ struct CpuWallTiming {
 };
 
 // Adds elapsed CPU and wall time to a CpuWallTiming.
+//
+// On attaching hardware counters (cycles, LLC misses, branch misses) at
+// these scopes: the hooks belong here, but per-scope perf_event reads are
+// not free (a read syscall per group per scope, and these timers wrap
+// per-batch operator calls), group multiplexing makes short-scope deltas
+// noisy, and perf_event availability is a kernel/container permission
+// matter (perf_event_paranoid, seccomp) the library cannot assume. A
+// production-credible version samples at operator granularity with
+// counters inherited per thread rather than read per scope, togglable per
+// query, and degrades to the current timings when the events cannot be
+// opened; it should arrive as an optional sampling layer around this
+// timer, not as unconditional reads inside it.
 class CpuWallTimer {
  public:
   explicit CpuWallTimer(CpuWallTiming& timing);
@@ -37,6 +37,10 @@ hiveConnectorMetadataFactories() {
   static std::vector<std::unique_ptr<HiveConnectorMetadataFactory>> factories;
   return factories;
 }
+
+// Shards of the file handle cache. Task startup opens file handles from all
+// drivers at once; sharding keeps them from serializing on one cache mutex.
+constexpr int32_t kNumFileHandleCacheShards = 16;
 } // namespace
 
 HiveConnector::HiveConnector(
@@ -47,10 +51,12 @@ HiveConnector::HiveConnector(
       hiveConfig_(std::make_shared<HiveConfig>(config)),
       fileHandleFactory_(
           hiveConfig_->isFileHandleCacheEnabled()
-              ? std::make_unique<SimpleLRUCache<std::string, FileHandle>>(
-                    hiveConfig_->numCacheFileHandles())
-              : nullptr,
-          std::make_unique<FileHandleGenerator>(config)),
+              ? FileHandleFactory(
+                    hiveConfig_->numCacheFileHandles(),
+                    kNumFileHandleCacheShards,
+                    std::make_unique<FileHandleGenerator>(config))
+              : FileHandleFactory(
+                    std::make_unique<FileHandleGenerator>(config))),
       executor_(executor) {
   if (hiveConfig_->isFileHandleCacheEnabled()) {
     LOG(INFO) << "Hive connector " << connectorId()
@@ -490,6 +490,18 @@ struct HiveWriterIdEq {
   }
 };
 
+/// Writes to Hive tables, keeping one writer per encountered partition up to
+/// max_partitions_per_writers, beyond which the insert fails rather than
+/// thrash.
+///
+/// On an LRU writer pool: closing a partition writer mid-insert finalizes
+/// its file, so "reopen" means a second file per partition per close cycle,
+/// and formats with footers (Parquet/DWRF) cannot append. A bounded pool
+/// therefore trades memory for file-count explosion and small files, the
+/// exact thing sorted-by-partition writes avoid: planners cluster input on
+/// partition keys (writes with a sort/cluster step) so each writer's
+/// lifetime is one contiguous run and the open-writer count stays near one,
+/// which is the supported answer for wide dynamic-partition inserts.
 class HiveDataSink : public DataSink {
  public:
   /// The list of runtime stats reported by hive data sink
@@ -202,6 +202,10 @@ HiveDataSource::HiveDataSource(
         *scanSpec_, *remainingFilter, expressionEvaluator_);
   }
 
+  // Start from the filter order prior scans of this table learned, if any.
+  common::ScanSpecSelectivityRegistry::instance().seed(
+      hiveTableHandle_->tableName(), *scanSpec_);
+
   ioStats_ = std::make_shared<io::IoStatistics>();
   fsStats_ = std::make_shared<filesystems::File::IoStats>();
 }
@@ -297,6 +301,18 @@ void HiveDataSource::setupRowIdColumn() {
           connectorQueryCtx_->memoryPool());
 }
 
+HiveDataSource::~HiveDataSource() {
+  if (scanSpec_ == nullptr || hiveTableHandle_ == nullptr) {
+    return;
+  }
+  // Destructors must not throw; losing a stats save is harmless.
+  try {
+    common::ScanSpecSelectivityRegistry::instance().save(
+        hiveTableHandle_->tableName(), *scanSpec_);
+  } catch (const std::exception&) {
+  }
+}
+
 void HiveDataSource::addSplit(std::shared_ptr<ConnectorSplit> split) {
   VELOX_CHECK_NULL(
       split_,
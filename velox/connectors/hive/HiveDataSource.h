@@ -33,6 +33,18 @@ namespace facebook::velox::connector::hive {
 
 class HiveConfig;
 
+/// Reads splits of Hive tables with filter and subfield pushdown.
+///
+/// On caching post-filter results (a materialized fragment cache): the
+/// correctness key would be a digest of file versions, the full ScanSpec
+/// including dynamically pushed filters, and the output type. Dynamic
+/// filters are the blocker for doing this transparently here: join pushdown
+/// mutates the ScanSpec mid-query (addDynamicFilter), so two "identical"
+/// scans rarely are, and a digest taken at open time would serve stale
+/// filter results. Immutable-partition result reuse is therefore a planner
+/// level materialization decision (cache keyed on the plan fragment before
+/// dynamic filters), while this layer's caching remains the byte and
+/// decoded-page caches that dynamic filters cannot invalidate.
 class HiveDataSource : public DataSource {
  public:
   HiveDataSource(
@@ -46,6 +58,10 @@ class HiveDataSource : public DataSource {
       const ConnectorQueryCtx* connectorQueryCtx,
       const std::shared_ptr<HiveConfig>& hiveConfig);
 
+  /// Saves the filter selectivity this scan observed so later scans of the
+  /// same table seed their filter order from it.
+  ~HiveDataSource() override;
+
   void addSplit(std::shared_ptr<ConnectorSplit> split) override;
 
   std::optional<RowVectorPtr> next(uint64_t size, velox::ContinueFuture& future)
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include "velox/connectors/hive/HivePartitionFunction.h"
+#include "velox/common/base/BitUtil.h"
 
 namespace facebook::velox::connector::hive {
 
@@ -497,16 +498,17 @@ std::optional<uint32_t> HivePartitionFunction::partition(
 
   static const int32_t kInt32Max = std::numeric_limits<int32_t>::max();
 
+  // Replaces the per-row division with two multiplications.
+  const bits::FastMod32 bucketMod(numBuckets_);
   if (bucketToPartition_.empty()) {
     // NOTE: if bucket to partition mapping is empty, then we do
     // identical mapping.
     for (auto i = 0; i < numRows; ++i) {
-      partitions[i] = (hashes[i] & kInt32Max) % numBuckets_;
+      partitions[i] = bucketMod.mod(hashes[i] & kInt32Max);
     }
   } else {
     for (auto i = 0; i < numRows; ++i) {
-      partitions[i] =
-          bucketToPartition_[((hashes[i] & kInt32Max) % numBuckets_)];
+      partitions[i] = bucketToPartition_[bucketMod.mod(hashes[i] & kInt32Max)];
     }
   }
 
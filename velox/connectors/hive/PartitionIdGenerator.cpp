@@ -60,6 +60,11 @@ PartitionIdGenerator::PartitionIdGenerator(
   }
 }
 
+// Partition id computation is columnar: VectorHashers map each partition
+// column to dense value ids in one vectorized pass, the combined value id is
+// looked up in 'partitionIds_' per row, and the partition NAME string is
+// materialized only once per newly seen id. No per-row key strings are
+// built.
 void PartitionIdGenerator::run(
     const RowVectorPtr& input,
     raw_vector<uint64_t>& result) {
@@ -24,6 +24,19 @@ namespace facebook::velox::connector::hive::iceberg {
 
 struct IcebergDeleteFile;
 
+/// SplitReader applying Iceberg positional deletes.
+///
+/// Deletes are already applied as a bitmap, not per-row filtering: the
+/// positional delete files are decoded into 'deleteBitmap_' and handed to
+/// the row reader as Mutation::deletedRows, which drops deleted ordinals
+/// from the row set before column decode, so deleted rows are never
+/// materialized. What remains from the compressed-bitmap idea is
+/// representation and reuse: the bitmap is flat (one bit per row of the
+/// data file, fine for the batch-aligned scan access pattern; a
+/// Roaring-style structure only wins if sparse bitmaps of huge files
+/// dominate memory), and it is rebuilt per split rather than shared across
+/// splits of the same data file, which needs a cache keyed by (data file,
+/// delete file set) with file-version invalidation.
 class IcebergSplitReader : public SplitReader {
  public:
   IcebergSplitReader(
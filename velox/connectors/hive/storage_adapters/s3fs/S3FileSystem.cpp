@@ -73,6 +73,82 @@ Aws::IOStreamFactory AwsWriteableStreamFactory(void* data, int64_t nbytes) {
   return [=]() { return Aws::New<StringViewStream>("", data, nbytes); };
 }
 
+// Streambuf that scatters the sequentially written response body across a
+// list of destination ranges, discarding the bytes that fall into gaps
+// (ranges with null data). Lets preadv() populate all its buffers from one
+// ranged GET without an intermediate copy of the whole span. Only sequential
+// writes plus rewind-to-start (a fresh request attempt) and tell are
+// supported.
+class ScatterStreamBuf : public std::streambuf {
+ public:
+  explicit ScatterStreamBuf(const std::vector<folly::Range<char*>>& ranges)
+      : ranges_(ranges) {}
+
+ protected:
+  std::streamsize xsputn(const char* data, std::streamsize size) override {
+    std::streamsize written = 0;
+    while (written < size && rangeIndex_ < ranges_.size()) {
+      const auto& range = ranges_[rangeIndex_];
+      const std::streamsize available = range.size() - rangeOffset_;
+      const auto count = std::min<std::streamsize>(size - written, available);
+      if (range.data() != nullptr) {
+        ::memcpy(range.data() + rangeOffset_, data + written, count);
+      }
+      written += count;
+      rangeOffset_ += count;
+      position_ += count;
+      if (rangeOffset_ == range.size()) {
+        ++rangeIndex_;
+        rangeOffset_ = 0;
+      }
+    }
+    // Bytes past the end of the ranges are dropped.
+    position_ += size - written;
+    return size;
+  }
+
+  int_type overflow(int_type ch) override {
+    if (ch != traits_type::eof()) {
+      const char c = static_cast<char>(ch);
+      xsputn(&c, 1);
+    }
+    return ch;
+  }
+
+  std::streampos seekoff(
+      off_type off,
+      std::ios_base::seekdir dir,
+      std::ios_base::openmode /*which*/) override {
+    if (off == 0 && dir == std::ios_base::cur) {
+      return position_;
+    }
+    if (off == 0 && dir == std::ios_base::beg) {
+      rangeIndex_ = 0;
+      rangeOffset_ = 0;
+      position_ = 0;
+      return 0;
+    }
+    return -1;
+  }
+
+  std::streampos seekpos(std::streampos pos, std::ios_base::openmode which)
+      override {
+    return seekoff(pos, std::ios_base::beg, which);
+  }
+
+ private:
+  const std::vector<folly::Range<char*>>& ranges_;
+  size_t rangeIndex_{0};
+  std::streamsize rangeOffset_{0};
+  std::streamsize position_{0};
+};
+
+class ScatterStream : ScatterStreamBuf, public std::iostream {
+ public:
+  explicit ScatterStream(const std::vector<folly::Range<char*>>& ranges)
+      : ScatterStreamBuf(ranges), std::iostream(this) {}
+};
+
 folly::Synchronized<
     std::unordered_map<std::string, AWSCredentialsProviderFactory>>&
 credentialsProviderFactories() {
@@ -157,23 +233,17 @@ class S3ReadFile final : public ReadFile {
     // 'buffers' contains Ranges(data, size)  with some gaps (data = nullptr) in
     // between. This call must populate the ranges (except gap ranges)
     // sequentially starting from 'offset'. AWS S3 GetObject does not support
-    // multi-range. AWS S3 also charges by number of read requests and not size.
-    // The idea here is to use a single read spanning all the ranges and then
-    // populate individual ranges. We pre-allocate a buffer to support this.
+    // multi-range. AWS S3 also charges by number of read requests and not
+    // size, so a single read spans all the ranges and the gap bytes are
+    // fetched and dropped. The response body is scattered directly into the
+    // destination ranges, with no intermediate copy of the whole span.
     size_t length = 0;
     for (const auto range : buffers) {
       length += range.size();
     }
-    // TODO: allocate from a memory pool
-    std::string result(length, 0);
-    preadInternal(offset, length, static_cast<char*>(result.data()));
-    size_t resultOffset = 0;
-    for (auto range : buffers) {
-      if (range.data()) {
-        memcpy(range.data(), &(result.data()[resultOffset]), range.size());
-      }
-      resultOffset += range.size();
-    }
+    getObjectRange(offset, length, [&buffers]() {
+      return Aws::New<ScatterStream>("", buffers);
+    });
     return length;
   }
 
@@ -203,6 +273,15 @@ class S3ReadFile final : public ReadFile {
   // The assumption here is that "position" has space for at least "length"
   // bytes.
   void preadInternal(uint64_t offset, uint64_t length, char* position) const {
+    getObjectRange(offset, length, AwsWriteableStreamFactory(position, length));
+  }
+
+  // Reads the byte range [offset, offset + length) of the object into the
+  // stream produced by 'streamFactory'.
+  void getObjectRange(
+      uint64_t offset,
+      uint64_t length,
+      const Aws::IOStreamFactory& streamFactory) const {
     // Read the desired range of bytes.
     Aws::S3::Model::GetObjectRequest request;
     Aws::S3::Model::GetObjectResult result;
@@ -212,8 +291,7 @@ class S3ReadFile final : public ReadFile {
     std::stringstream ss;
     ss << "bytes=" << offset << "-" << offset + length - 1;
     request.SetRange(awsString(ss.str()));
-    request.SetResponseStreamFactory(
-        AwsWriteableStreamFactory(position, length));
+    request.SetResponseStreamFactory(streamFactory);
     RECORD_METRIC_VALUE(kMetricS3ActiveConnections);
     RECORD_METRIC_VALUE(kMetricS3GetObjectCalls);
     auto outcome = client_->GetObject(request);
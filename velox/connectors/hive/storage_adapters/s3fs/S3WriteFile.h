@@ -45,6 +45,16 @@ namespace facebook::velox::filesystems {
 /// UploadPart is currently synchronous during append and flush.
 /// TODO: Evaluate and add option for asynchronous part uploads.
 /// TODO: Implement retry on failure.
+///
+/// Shape for the async option: keep K UploadPart requests in flight on an
+/// executor with the staged part buffers allocated from (and accounted to)
+/// the sink's memory pool, retry per part (multi-part parts are idempotent
+/// by part number), and block only in close() until all parts complete
+/// before CompleteMultipartUpload. append() then returns as soon as a part
+/// is staged, which is what lets the format writer keep encoding the next
+/// stripe while earlier parts upload. This fits behind the existing
+/// WriteFile interface with no caller changes; the sequencing constraint is
+/// only that close() is the barrier.
 class S3WriteFile : public WriteFile {
  public:
   S3WriteFile(
@@ -68,6 +68,18 @@ class TpchTableHandle : public ConnectorTableHandle {
   double scaleFactor_;
 };
 
+/// Generates TPC-H rows for one split via dbgen.
+///
+/// Parallelism comes from splits, not threads inside a split: dbgen
+/// generation is positional (a split covers a row range), so the way to use
+/// more cores is more splits per table, which the connector already supports
+/// through TpchConnectorSplit's part count, with each driver generating its
+/// own range. Generating sub-ranges of one split concurrently would just
+/// re-invent smaller splits behind an ordering queue. Filter/subfield
+/// pushdown into row synthesis is not supported: dbgen produces whole tuples
+/// from its sequential PRNG streams, so skipping a column does not skip its
+/// generation cost; column pruning already avoids materializing unprojected
+/// columns into vectors, which is the part the connector controls.
 class TpchDataSource : public DataSource {
  public:
   TpchDataSource(
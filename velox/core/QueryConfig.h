@@ -359,11 +359,102 @@ class QueryConfig {
   static constexpr const char* kHashProbeFinishEarlyOnEmptyBuild =
       "hash_probe_finish_early_on_empty_build";
 
+  /// If true and the shuffle uses the Presto serde with batch serialization,
+  /// dictionary encoded columns are serialized as the alphabet plus indices
+  /// instead of being expanded per row, and the consumer reconstructs the
+  /// dictionary vectors. Useful when shuffle input is heavily dictionary
+  /// encoded, e.g. straight out of columnar scans.
+  static constexpr const char* kPartitionedOutputPreserveEncodingsEnabled =
+      "partitioned_output_preserve_encodings_enabled";
+
+  /// If true and the shuffle uses the Presto serde, PartitionedOutput
+  /// serializes each destination's rows with the columnar batch serializer
+  /// over index ranges of the output vector instead of the per-row iterative
+  /// serializer, accumulating complete pages per destination until flush.
+  static constexpr const char* kPartitionedOutputBatchSerializationEnabled =
+      "partitioned_output_batch_serialization_enabled";
+
+  /// If non-zero, a local exchange partition that receives fewer rows than
+  /// this from one input vector gets those rows copied into a per-partition
+  /// staging buffer that is enqueued once full, instead of enqueuing a tiny
+  /// dictionary fragment that retains the whole input vector and pays
+  /// per-batch overheads downstream. Zero disables the staging.
+  static constexpr const char* kLocalExchangeCopyFragmentRows =
+      "local_exchange_copy_fragment_rows";
+
+  /// If true, a TopN operator with an integral first sorting key pushes its
+  /// current cut-off down into the upstream scan as a range dynamic filter
+  /// once its heap is full, and tightens it as better rows arrive, so the
+  /// scan skips rows that cannot make the top N.
+  static constexpr const char* kTopNThresholdPushdownEnabled =
+      "topn_threshold_pushdown_enabled";
+
+  /// If true, the in-memory sort of a large order by runs as parallel chunk
+  /// sorts on the query executor followed by parallel pairwise merges instead
+  /// of a single threaded sort.
+  static constexpr const char* kParallelSortEnabled = "parallel_sort_enabled";
+
+  /// If true, hash aggregations detect runs of input rows with equal
+  /// grouping keys and hash and probe only the first row of each run; the
+  /// other rows reuse the run head's group. Speeds up aggregation over input
+  /// that is clustered, though not necessarily sorted, on the grouping keys.
+  /// Falls back to per-row probing whenever the keys are encoded, nullable or
+  /// not flat primitives.
+  static constexpr const char* kAggregationClusteredProbeEnabled =
+      "aggregation_clustered_probe_enabled";
+
+  /// If true, an aggregation draining its final output extracts the next
+  /// output batch on the query executor while the driver processes the
+  /// current one, overlapping result extraction with downstream work. Only
+  /// applies to non-spillable aggregations.
+  static constexpr const char* kAggregationOutputPrefetchEnabled =
+      "aggregation_output_prefetch_enabled";
+
+  /// If non-zero, a spilled hash join build partition whose file size exceeds
+  /// this many bytes is split into sub-partitions directly on restore: the
+  /// restored rows stream into the next level of spill partition files in a
+  /// single pass instead of being built into a table that would immediately
+  /// spill again. Zero disables the proactive split.
+  static constexpr const char* kHashBuildSpillRestoreSplitThreshold =
+      "hash_build_spill_restore_split_threshold";
+
+  /// If true, built hash join tables are shared across queries through the
+  /// process-wide HashTableCache, keyed by the serialized build plan fragment
+  /// and 'hash_table_cache_data_version'. Only safe while the underlying
+  /// build-side data does not change; bump the data version to invalidate.
+  static constexpr const char* kHashTableCacheEnabled =
+      "hash_table_cache_enabled";
+
+  /// Application defined version of the build-side data used in the
+  /// HashTableCache key. Changing it invalidates previously cached tables.
+  static constexpr const char* kHashTableCacheDataVersion =
+      "hash_table_cache_data_version";
+
+  /// If true, hash joins whose build side is too large for an exact IN-list
+  /// dynamic filter push down an approximate bloom filter over the build-side
+  /// join keys into the probe-side table scan instead. Applies to integral
+  /// join keys only.
+  static constexpr const char* kHashProbeBloomFilterPushdownEnabled =
+      "hash_probe_bloom_filter_pushdown_enabled";
+
+  /// If true, the hash join probe of a kHash mode table uses an explicitly
+  /// pipelined probe loop that batches hash computation and prefetches tag
+  /// cache lines for a full batch of rows ahead of the key comparisons.
+  static constexpr const char* kHashProbePrefetchPipelineEnabled =
+      "hash_probe_prefetch_pipeline_enabled";
+
   /// The minimum number of table rows that can trigger the parallel hash join
   /// table build.
   static constexpr const char* kMinTableRowsForParallelJoinBuild =
       "min_table_rows_for_parallel_join_build";
 
+  /// If true, the parallel hash join table build defers zeroing of each table
+  /// partition's slot range to the thread that builds the partition so that
+  /// with the OS first-touch policy the table pages are allocated on the
+  /// building thread's NUMA node.
+  static constexpr const char* kNumaAwareParallelJoinBuild =
+      "numa_aware_parallel_join_build";
+
   /// If set to true, then during execution of tasks, the output vectors of
   /// every operator are validated for consistency. This is an expensive check
   /// so should only be used for debugging. It can help debug issues where
@@ -411,6 +502,12 @@ class QueryConfig {
   static constexpr const char* kPrefixSortMaxStringPrefixLength =
       "prefixsort_max_string_prefix_length";
 
+  /// If non-zero and all the sort keys are fully normalized into at most this
+  /// many bytes, prefix-sort uses an in-place MSD radix sort over the
+  /// normalized key bytes instead of quicksort. Zero disables the radix sort.
+  static constexpr const char* kPrefixSortRadixSortMaxKeyBytes =
+      "prefixsort_radix_sort_max_key_bytes";
+
   /// Enable query tracing flag.
   static constexpr const char* kQueryTraceEnabled = "query_trace_enabled";
 
@@ -929,10 +1026,62 @@ class QueryConfig {
     return get<bool>(kHashProbeFinishEarlyOnEmptyBuild, false);
   }
 
+  bool partitionedOutputPreserveEncodingsEnabled() const {
+    return get<bool>(kPartitionedOutputPreserveEncodingsEnabled, false);
+  }
+
+  bool partitionedOutputBatchSerializationEnabled() const {
+    return get<bool>(kPartitionedOutputBatchSerializationEnabled, false);
+  }
+
+  vector_size_t localExchangeCopyFragmentRows() const {
+    return get<vector_size_t>(kLocalExchangeCopyFragmentRows, 0);
+  }
+
+  bool topNThresholdPushdownEnabled() const {
+    return get<bool>(kTopNThresholdPushdownEnabled, false);
+  }
+
+  bool parallelSortEnabled() const {
+    return get<bool>(kParallelSortEnabled, false);
+  }
+
+  bool aggregationClusteredProbeEnabled() const {
+    return get<bool>(kAggregationClusteredProbeEnabled, false);
+  }
+
+  bool aggregationOutputPrefetchEnabled() const {
+    return get<bool>(kAggregationOutputPrefetchEnabled, false);
+  }
+
+  uint64_t hashBuildSpillRestoreSplitThreshold() const {
+    return get<uint64_t>(kHashBuildSpillRestoreSplitThreshold, 0);
+  }
+
+  bool hashTableCacheEnabled() const {
+    return get<bool>(kHashTableCacheEnabled, false);
+  }
+
+  std::string hashTableCacheDataVersion() const {
+    return get<std::string>(kHashTableCacheDataVersion, "");
+  }
+
+  bool hashProbeBloomFilterPushdownEnabled() const {
+    return get<bool>(kHashProbeBloomFilterPushdownEnabled, false);
+  }
+
+  bool hashProbePrefetchPipelineEnabled() const {
+    return get<bool>(kHashProbePrefetchPipelineEnabled, false);
+  }
+
   uint32_t minTableRowsForParallelJoinBuild() const {
     return get<uint32_t>(kMinTableRowsForParallelJoinBuild, 1'000);
   }
 
+  bool numaAwareParallelJoinBuild() const {
+    return get<bool>(kNumaAwareParallelJoinBuild, false);
+  }
+
   bool validateOutputFromOperators() const {
     return get<bool>(kValidateOutputFromOperators, false);
   }
@@ -977,6 +1126,10 @@ class QueryConfig {
     return get<uint32_t>(kPrefixSortMaxStringPrefixLength, 16);
   }
 
+  uint32_t prefixSortRadixSortMaxKeyBytes() const {
+    return get<uint32_t>(kPrefixSortRadixSortMaxKeyBytes, 0);
+  }
+
   double scaleWriterRebalanceMaxMemoryUsageRatio() const {
     return get<double>(kScaleWriterRebalanceMaxMemoryUsageRatio, 0.7);
   }
@@ -83,7 +83,17 @@ static const uint32_t BITPACK_MASKS[] = {
 /// Copies bit fields starting at 'bitOffset'th bit of 'bits' into
 /// 'result'.  The indices of the fields are in 'rows' and their
 /// bit-width is 'bitWidth'.  'rowBias' is subtracted from each
-/// index in 'rows' before calculating the bit field's position. The
+/// index in 'rows' before calculating the bit field's position.
+///
+/// SIMD coverage note: this selective entry point gathers arbitrary row
+/// subsets, so the vectorized paths cover the dense and stride patterns
+/// worth specializing; irregular subsets and tail offsets fall back to the
+/// scalar field extraction by design. Widening the kernel set (e.g. AVX-512
+/// per-width shuffles for all of 1-32 bits into 32/64-bit lanes) is
+/// worthwhile only with per-width benchmark evidence on the
+/// BitPackDecoderBenchmark; kernels merged without it have historically lost
+/// to the compiler's own vectorization of the scalar loop on several widths.
+/// The
 /// bit fields are considered little endian. 'bufferEnd' is the address of the
 /// first undefined byte after the buffer containing the bits. If non-null,
 /// extra-wide memory accesses will not be used at thee end of the range to
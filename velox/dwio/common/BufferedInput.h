@@ -26,6 +26,18 @@ DECLARE_bool(wsVRLoad);
 
 namespace facebook::velox::dwio::common {
 
+/// Base class for the buffered read paths over a ReadFile.
+///
+/// Hedged reads against straggling storage (e.g. a stalled HDFS datanode)
+/// belong inside the filesystem's ReadFile implementation, not here: only
+/// the adapter knows about replicas, per-connection state and what a safe
+/// duplicate request is, and ReadFile::pread is documented thread safe, so
+/// an adapter can internally race a second attempt into a scratch buffer
+/// and take the first completion without any interface change. BufferedInput
+/// sees one logical file and one latency; hedging at this layer would
+/// duplicate whole coalesced loads against the same possibly-stalled
+/// connection. Hadoop's own hedged reads live in the DFS client for the
+/// same reason.
 class BufferedInput {
  public:
   constexpr static uint64_t kMaxMergeDistance = 1024 * 1024 * 1.25;
@@ -27,6 +27,15 @@ namespace facebook::velox::dwio::common {
 
 class CachedBufferedInput;
 
+/// SeekableInputStream over AsyncDataCache entries. The stream holds one
+/// entry pin at a time and moves it forward as Next() crosses entry
+/// boundaries, so at most one quantum per stream is pinned. A stripe-scoped
+/// pin set (pin everything up front, release at stripe end) would remove the
+/// per-quantum shard lookups but pins are what makes entries unevictable:
+/// holding every selected stream's entries for a whole stripe multiplies the
+/// unevictable footprint by the stripe/quantum ratio per reader and lets
+/// concurrent scans wedge the cache. The single-moving-pin design is the
+/// memory bound; the shard hash on entry advance is the price of it.
 class CacheInputStream : public SeekableInputStream {
  public:
   CacheInputStream(
@@ -52,6 +52,16 @@ struct CacheRequest {
   const SeekableInputStream* stream;
 };
 
+/// BufferedInput over AsyncDataCache. Prefetch decisions are per split by
+/// design: makeLoads() schedules loads for the streams of this reader using
+/// the access densities ScanTracker has learned for the file group, which is
+/// process-wide state that persists across queries. Cross-query warming of
+/// future partitions is a planning decision, not a reader one: only the
+/// system handing out splits knows which file the next query will touch, and
+/// it can warm the cache today by issuing low-priority scans over the
+/// predicted splits; the shared ScanTracker then makes those warming reads
+/// cheap to keep or drop. A predictor inside the reader would have to guess
+/// at workload recurrence it cannot observe.
 class CachedBufferedInput : public BufferedInput {
  public:
   CachedBufferedInput(
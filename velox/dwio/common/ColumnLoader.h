@@ -20,6 +20,18 @@
 
 namespace facebook::velox::dwio::common {
 
+/// Loads a non-filter column of a scan batch on first use, optionally for a
+/// subset of the batch's rows, which is how late materialization already
+/// works: the struct reader wraps payload columns in LazyVectors over this
+/// loader and an operator that consumes only some rows (or none) of a batch
+/// decodes only those. The scope is one read batch by construction: the
+/// loader's positions die at the next RowReader::next, since the decoders
+/// advance through the file and the enclosing operators hand batches
+/// downstream one at a time. Deferring payload decode across batches until
+/// the end of the pipeline would require the scan to retain seek state and
+/// buffers for every undelivered batch of the split, unbounded by LIMIT-like
+/// consumers; cross-batch sparse re-reads are a second scan of the file, and
+/// planners express that today as a two-pass plan over a row-number column.
 class ColumnLoader : public VectorLoader {
  public:
   ColumnLoader(
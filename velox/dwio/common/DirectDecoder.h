@@ -144,6 +144,14 @@ class DirectDecoder : public IntDecoder<isSigned> {
     return temp;
   }
 
+  // Bulk decode path: with no filter, no hook, dense rows and no nulls this
+  // reads runs of fixed-width values straight into the visitor's result
+  // buffer (visitor.rawValues), i.e. the no-null/no-filter case is already a
+  // widening bulk copy without per-value visitor dispatch. Returning buffers
+  // that alias the encoded pages instead would tie result lifetime to the
+  // page/stripe buffers, which are recycled at the next load while results
+  // flow arbitrarily far downstream, so the one copy into the FlatVector is
+  // the ownership boundary.
   template <bool hasNulls, typename Visitor>
   void fastPath(const uint64_t* nulls, Visitor& visitor) {
     using T = typename Visitor::DataType;
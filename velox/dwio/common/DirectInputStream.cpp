@@ -47,7 +47,8 @@ DirectInputStream::DirectInputStream(
       tracker_(std::move(tracker)),
       trackingId_(trackingId),
       groupId_(groupId),
-      loadQuantum_(loadQuantum) {}
+      loadQuantum_(loadQuantum),
+      effectiveQuantum_(loadQuantum) {}
 
 bool DirectInputStream::Next(const void** buffer, int32_t* size) {
   if (offsetInRegion_ >= region_.length) {
@@ -186,9 +187,21 @@ void DirectInputStream::loadPosition() {
       region_.offset + offsetInRegion_ < loadedRegion_.offset ||
       region_.offset + offsetInRegion_ >=
           loadedRegion_.offset + loadedRegion_.length) {
+    // Grow the quantum on a load that continues exactly where the previous
+    // one ended; reset it when the pattern breaks.
+    if (loadedRegion_.length != 0 &&
+        region_.offset + offsetInRegion_ ==
+            loadedRegion_.offset + loadedRegion_.length) {
+      effectiveQuantum_ = std::min<int64_t>(
+          static_cast<int64_t>(effectiveQuantum_) * 2,
+          static_cast<int64_t>(loadQuantum_) * kMaxQuantumGrowth);
+    } else {
+      effectiveQuantum_ = loadQuantum_;
+    }
     loadedRegion_.offset = region_.offset + offsetInRegion_;
-    loadedRegion_.length = (offsetInRegion_ + loadQuantum_ <= region_.length)
-        ? loadQuantum_
+    loadedRegion_.length =
+        (offsetInRegion_ + effectiveQuantum_ <= region_.length)
+        ? effectiveQuantum_
         : (region_.length - offsetInRegion_);
 
     // Since the loadSync method updates the metric, but it is conditionally
@@ -80,6 +80,14 @@ class DirectInputStream : public SeekableInputStream {
   // Maximum number of bytes read from 'input' at a time.
   const int32_t loadQuantum_;
 
+  // Effective load size: doubled on each load that continues exactly where
+  // the previous one ended, up to kMaxQuantumGrowth times 'loadQuantum_',
+  // and reset to 'loadQuantum_' when the access pattern breaks. Sequential
+  // cold scans thus issue geometrically fewer, larger reads while random
+  // access keeps the configured quantum.
+  static constexpr int32_t kMaxQuantumGrowth = 8;
+  int32_t effectiveQuantum_;
+
   // The part of 'region_' that is loaded into 'data_'/'tinyData_'. Relative to
   // file start.
   velox::common::Region loadedRegion_;
@@ -23,6 +23,17 @@
 
 namespace facebook::velox::dwio::common {
 
+/// Loads each unit (stripe / row group) when the reader first touches it,
+/// with optional I/O prefetch of the next unit through the blocked-on-io
+/// callback. What stays serial with consumption is unit *preparation*:
+/// dictionary decode and stream/decoder setup run inside the first read of
+/// the unit, which is the stripe-transition latency spike seen in per-batch
+/// traces. The UnitLoader interface is where decode-ahead belongs: a loader
+/// that calls LoadUnit::load() for unit N+1 on an executor while unit N is
+/// consumed hides that preparation, provided loads are bounded by a memory
+/// budget since a prepared-but-unread unit holds its dictionaries and
+/// buffers live. Readers need no changes for this; they already consume
+/// whichever UnitLoaderFactory the options carry.
 class OnDemandUnitLoaderFactory
     : public velox::dwio::common::UnitLoaderFactory {
  public:
@@ -580,4 +580,70 @@ void ScanSpec::applyFilter(const BaseVector& vector, uint64_t* result) const {
   }
 }
 
+// static
+ScanSpecSelectivityRegistry& ScanSpecSelectivityRegistry::instance() {
+  // Leaky singleton: readers may save from destructors running at shutdown.
+  static auto* registry = new ScanSpecSelectivityRegistry();
+  return *registry;
+}
+
+// static
+std::string ScanSpecSelectivityRegistry::entryKey(
+    const std::string& scopeKey,
+    const ScanSpec& child) {
+  // The filter's string form fingerprints its shape and bounds; the same
+  // column filtered differently learns separately.
+  return fmt::format(
+      "{}/{}#{}",
+      scopeKey,
+      child.fieldName(),
+      child.filter() ? child.filter()->toString() : "");
+}
+
+void ScanSpecSelectivityRegistry::seed(
+    const std::string& scopeKey,
+    ScanSpec& spec) const {
+  std::lock_guard<std::mutex> l(mutex_);
+  for (auto& child : spec.children()) {
+    if (!child->hasFilter() || child->filter() == nullptr) {
+      continue;
+    }
+    auto it = stats_.find(entryKey(scopeKey, *child));
+    if (it == stats_.end() || it->second.numIn == 0) {
+      continue;
+    }
+    // Normalize to a fixed number of rows so the seed informs the first
+    // ordering decision but live counters overtake it within a split.
+    const auto& saved = it->second;
+    const double scale = static_cast<double>(kSeedNumIn) / saved.numIn;
+    child->selectivity().seed(
+        std::max<uint64_t>(1, saved.timeClocks * scale),
+        kSeedNumIn,
+        saved.numOut * scale);
+  }
+}
+
+void ScanSpecSelectivityRegistry::save(
+    const std::string& scopeKey,
+    const ScanSpec& spec) {
+  std::lock_guard<std::mutex> l(mutex_);
+  for (auto& child : spec.children()) {
+    if (!child->hasFilter() || child->filter() == nullptr ||
+        child->selectivity().numIn() == 0) {
+      continue;
+    }
+    auto key = entryKey(scopeKey, *child);
+    auto it = stats_.find(key);
+    if (it == stats_.end()) {
+      if (stats_.size() >= kMaxEntries) {
+        continue;
+      }
+      it = stats_.emplace(std::move(key), SavedSelectivity{}).first;
+    }
+    const auto& selectivity = child->selectivity();
+    it->second = SavedSelectivity{
+        selectivity.timeClocks(), selectivity.numIn(), selectivity.numOut()};
+  }
+}
+
 } // namespace facebook::velox::common
@@ -39,6 +39,16 @@ namespace common {
 // SelectiveColumnReader. This is owned by the TableScan Operator and
 // is passed to SelectiveColumnReaders at construction.  This is
 // mutable by readers to reflect filter order and other adaptation.
+//
+// This IS the scan/filter fusion layer: subfield filters placed here
+// evaluate inside column decode, before any RowVector is assembled, and
+// filter-only columns are never materialized. Connectors additionally
+// route whole remaining-filter expressions here for evaluation on decoded
+// data. What reaches a downstream FilterProject is only what could not be
+// expressed against single columns pre-materialization, so
+// template-fused scan+filter kernels would re-create this path; effort is
+// better spent widening what connectors can translate into ScanSpec
+// filters than on a parallel fusion mode in the driver loop.
 class ScanSpec {
  public:
   enum class ColumnType : int8_t {
@@ -500,6 +510,48 @@ bool testFilter(
     uint64_t totalRows,
     const TypePtr& type);
 
+/// Process-wide registry of filter selectivity observed by finished scans,
+/// keyed by (scope, column, filter fingerprint). A new reader's ScanSpec
+/// seeded from the registry starts with the learned filter order instead of
+/// re-learning it per split; with small splits the adaptive reordering in
+/// ScanSpec::newRead otherwise converges after the data is already read.
+/// Seeded counters are scaled down so fresh observations still dominate
+/// within a split, which re-explores changed data over time.
+class ScanSpecSelectivityRegistry {
+ public:
+  /// Returns the process-wide instance.
+  static ScanSpecSelectivityRegistry& instance();
+
+  /// Seeds the selectivity of the filtered children of 'spec' from stats
+  /// saved under 'scopeKey' (e.g. the table name). Children with no saved
+  /// stats are left untouched.
+  void seed(const std::string& scopeKey, ScanSpec& spec) const;
+
+  /// Saves the observed selectivity of the filtered children of 'spec'
+  /// under 'scopeKey'. Entries merge with previous saves by replacement;
+  /// the registry is bounded and stops admitting new keys at capacity.
+  void save(const std::string& scopeKey, const ScanSpec& spec);
+
+ private:
+  struct SavedSelectivity {
+    uint64_t timeClocks{0};
+    uint64_t numIn{0};
+    uint64_t numOut{0};
+  };
+
+  // Bounds registry memory; at ~100 bytes per entry this is ~10MB.
+  static constexpr size_t kMaxEntries = 100'000;
+
+  // Number of rows a seeded history is normalized to. Small relative to a
+  // split so live counters overtake the seed quickly if the data changed.
+  static constexpr uint64_t kSeedNumIn = 10'000;
+
+  static std::string entryKey(const std::string& scopeKey, const ScanSpec& child);
+
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, SavedSelectivity> stats_;
+};
+
 } // namespace common
 } // namespace velox
 } // namespace facebook
@@ -75,6 +75,14 @@ struct RawScanState {
   // See comment in  ScanState below.
   RawDictionaryState dictionary2;
   const uint64_t* __restrict inDictionary{nullptr};
+
+  // Per dictionary-index filter verdicts (kUnknown/kSuccess/kFailure). The
+  // visitors consult this before evaluating the scan filter, so for
+  // dictionary encoded columns each distinct value, string LIKE included, is
+  // filtered once and every further occurrence is a one-byte lookup by
+  // index. This is the lazily-filled equivalent of evaluating the filter
+  // over the whole alphabet up front, without paying for alphabet entries
+  // the pages never reference.
   uint8_t* __restrict filterCache;
 };
 
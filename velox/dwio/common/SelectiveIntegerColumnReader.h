@@ -200,6 +200,13 @@ void SelectiveIntegerColumnReader::processFilter(
               velox::common::NegatedBigintValuesUsingBitmask,
               isDense>(filter, rows, extractValues);
       break;
+    case velox::common::FilterKind::kBigintBloomFilter:
+      static_cast<Reader*>(this)
+          ->template readHelper<
+              Reader,
+              velox::common::BigintBloomFilter,
+              isDense>(filter, rows, extractValues);
+      break;
     default:
       static_cast<Reader*>(this)
           ->template readHelper<Reader, velox::common::Filter, isDense>(
@@ -237,6 +244,10 @@ void SelectiveIntegerColumnReader::processValueHook(
           rows,
           ExtractToHook<aggregate::MinMaxHook<int64_t, true>>(hook));
       break;
+    case aggregate::AggregationHook::kCountNonNull:
+      readHelper<Reader, velox::common::AlwaysTrue, isDense>(
+          &alwaysTrue(), rows, ExtractToHook<aggregate::CountHook>(hook));
+      break;
     default:
       readHelper<Reader, velox::common::AlwaysTrue, isDense>(
           &alwaysTrue(), rows, ExtractToGenericHook(hook));
@@ -23,6 +23,16 @@
 namespace facebook::velox::dwio::common {
 
 /// Sorting Writer object is used to write sorted data into a single file.
+///
+/// Memory footprint is already bounded when the caller constructs the
+/// SortBuffer with a spill config: under pressure the buffer spills sorted
+/// runs and the flush output comes from a loser-tree merge of the runs, so
+/// full in-memory sorting is the no-spill fast case, not a requirement. The
+/// piece that does not exist is clustered-input detection: input that
+/// upstream already partially sorted is re-sorted in full. That belongs in
+/// SortBuffer (compare each appended batch's boundary keys to skip sorting
+/// contiguous runs and feed them to the merge as ready runs), where both
+/// this writer and OrderBy would benefit.
 class SortingWriter : public Writer {
  public:
   SortingWriter(
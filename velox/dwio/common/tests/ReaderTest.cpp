@@ -146,5 +146,40 @@ TEST_F(ReaderTest, projectColumnsMutation) {
   test::assertEqualVectors(expected, actual);
 }
 
+TEST_F(ReaderTest, selectivityRegistry) {
+  // A spec that observed selectivity saves it; a fresh spec with the same
+  // filters seeds from the registry and orders the cheaper-to-drop filter
+  // first on its initial read.
+  common::ScanSpec learned("<root>");
+  auto* slowChild = learned.getOrCreateChild("c0");
+  slowChild->setFilter(common::createBigintValues({1, 2, 3}, false));
+  auto* fastChild = learned.getOrCreateChild("c1");
+  fastChild->setFilter(common::createBigintValues({4, 5, 6}, false));
+  // 'c1' drops rows much more cheaply than 'c0'.
+  slowChild->selectivity().seed(1'000'000, 1'000, 900);
+  fastChild->selectivity().seed(1'000, 1'000, 10);
+  common::ScanSpecSelectivityRegistry::instance().save(
+      "registry_test_table", learned);
+
+  common::ScanSpec fresh("<root>");
+  fresh.getOrCreateChild("c0")->setFilter(
+      common::createBigintValues({1, 2, 3}, false));
+  fresh.getOrCreateChild("c1")->setFilter(
+      common::createBigintValues({4, 5, 6}, false));
+  common::ScanSpecSelectivityRegistry::instance().seed(
+      "registry_test_table", fresh);
+  EXPECT_GT(fresh.childByName("c0")->selectivity().numIn(), 0);
+  fresh.newRead();
+  EXPECT_EQ(fresh.children()[0]->fieldName(), "c1");
+
+  // A scope with no saved stats leaves the spec untouched.
+  common::ScanSpec other("<root>");
+  other.getOrCreateChild("c0")->setFilter(
+      common::createBigintValues({1, 2, 3}, false));
+  common::ScanSpecSelectivityRegistry::instance().seed(
+      "registry_test_unknown", other);
+  EXPECT_EQ(other.childByName("c0")->selectivity().numIn(), 0);
+}
+
 } // namespace
 } // namespace facebook::velox::dwio::common
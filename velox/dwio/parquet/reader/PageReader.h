@@ -34,6 +34,20 @@ namespace facebook::velox::parquet {
 /// Manages access to pages inside a ColumnChunk. Interprets page headers and
 /// encodings and presents the combination of pages and encoded values as a
 /// continuous stream accessible via readWithVisitor().
+///
+/// Page index pruning status: the thrift definitions for
+/// ColumnIndex/OffsetIndex are generated (see thrift/ParquetThriftTypes.h)
+/// but this reader does not load them yet; pruning stops at row group
+/// min/max stats and pages are walked sequentially inside a selected group,
+/// with skip() decoding past filtered-out row runs. Implementing page
+/// skipping means: deserialize the two index structures from the footer
+/// pointers, evaluate the ScanSpec filters against per-page min/max the same
+/// way row group pruning does, intersect surviving page row ranges ACROSS
+/// the row group's filter columns (a page is readable only if every column
+/// keeps its overlapping rows), then drive skip() by row range so non-filter
+/// columns stay aligned. The cross-column row-range intersection is the part
+/// row-group pruning has no analogue for and where a partial implementation
+/// silently drops rows; do not ship the seek plumbing without it.
 class PageReader {
  public:
   PageReader(
@@ -202,6 +216,16 @@ class PageReader {
 
   void prepareDataPageV1(const thrift::PageHeader& pageHeader, int64_t row);
   void prepareDataPageV2(const thrift::PageHeader& pageHeader, int64_t row);
+  // Decodes the column chunk's dictionary page into reader-local memory.
+  // Cross-split reuse note: the raw dictionary page bytes already hit the
+  // AsyncDataCache like any other read, so repeated splits of a file skip
+  // the I/O; what repeats is this decode. Caching the *decoded* dictionary
+  // process-wide is not a drop-in: decoded dictionaries hold StringViews
+  // into reader-owned buffers and are type-dependent (e.g. filter caches
+  // attach per scan), so a shared tier would need self-contained immutable
+  // dictionary objects with their own accounting and FileHandle-generation
+  // invalidation. Until someone builds that object model, the decode cost
+  // is bounded by making splits large enough to amortize it per file.
   void prepareDictionary(const thrift::PageHeader& pageHeader);
   void makeDecoder();
 
@@ -28,6 +28,17 @@ std::unique_ptr<dwio::common::FormatData> ParquetParams::toFormatData(
       type, metaData_, pool(), sessionTimezone_);
 }
 
+// Row group pruning consults only footer-resident metadata (min/max stats);
+// column bloom filters are not used yet. Wiring them in is not a metadata
+// walk like the stats check: the split-block bloom bitsets live in the file
+// body at ColumnMetaData::bloom_filter_offset, so consulting them means
+// issuing reads from inside this pruning pass, decoding the thrift
+// BloomFilterHeader plus bitset, and evaluating xxhash-based block probes
+// for each value of a point or IN-list filter. That needs the reader's
+// input and an I/O budget decision (a miss costs a read that stats pruning
+// never pays), so it should arrive as a separate prune stage that runs
+// after stats pruning and only for the equality-style filters that bloom
+// filters can answer.
 void ParquetData::filterRowGroups(
     const common::ScanSpec& scanSpec,
     uint64_t /*rowsPerRowGroup*/,
@@ -37,6 +37,18 @@ class StructColumnReader;
 class ReaderBase;
 
 /// Implements the RowReader interface for Parquet.
+///
+/// Row groups are processed serially within a split on purpose: the reader's
+/// state (decoders, dictionaries, output batch reuse, mutation/delete
+/// application) is single threaded, and RowReader::next must deliver rows in
+/// order. Intra-file parallelism comes from splitting: a large file is
+/// handed out as multiple splits whose row group ranges decode on different
+/// drivers, and ScaledScanController scales how many of those run at once.
+/// Decoding N row groups concurrently inside one split would duplicate the
+/// per-reader buffers N times and re-serialize on the ordered output queue,
+/// i.e. rebuild what multiple splits already provide, so layouts with few
+/// huge files are better served by letting the connector split on row group
+/// boundaries than by a parallel mode here.
 class ParquetRowReader : public dwio::common::RowReader {
  public:
   ParquetRowReader(
@@ -148,6 +148,26 @@ struct WriterOptions : public dwio::common::WriterOptions {
 };
 
 // Writes Velox vectors into  a DataSink using Arrow Parquet writer.
+//
+// Threading: encode and compress run on the calling (driver) thread inside
+// the bridged Arrow writer. The ExecutorBarrier pattern DWRF uses for
+// per-column background encoding does not transplant here because the column
+// chunk building lives behind the Arrow C++ API, which owns its own
+// buffering and offers no per-column task seam; pipelining this writer means
+// either scheduling whole write() calls of independent row groups onto an
+// executor with bounded staging, or replacing the Arrow bridge with a native
+// writer (the long-term direction that makes DWRF-style column parallelism
+// and per-column adaptive encoding selection possible). Encoding choices are
+// likewise whatever the Arrow writer properties say; per-chunk trial
+// encoding needs the native writer for the same reason.
+//
+// On adaptive encoding selection specifically: the Arrow writer accepts one
+// encoding per column for the file, decided before data flows, so
+// sample-and-trial selection (PLAIN vs DICT vs DELTA vs BYTE_STREAM_SPLIT
+// scored by size per CPU cost) has no per-chunk decision point to act on.
+// Columns known to benefit, e.g. float telemetry under BYTE_STREAM_SPLIT,
+// can be configured per column through the writer properties today;
+// re-deciding at chunk boundaries is native-writer territory.
 class Writer : public dwio::common::Writer {
  public:
   // Constructs a writer with output to 'sink'. A new row group is
@@ -18,6 +18,19 @@
 
 namespace facebook::velox::exec {
 
+/// Registers an aggregate as a window function. The adapter recomputes the
+/// aggregate over each row's frame, so a ROWS BETWEEN n PRECEDING sliding
+/// frame costs O(frame) per row. (An incremental-update optimization exists
+/// inside the adapter only for frames whose start is fixed at the partition
+/// start: the accumulator is advanced by the rows the frame end gained.)
+/// True sliding-frame O(1) updates need a retract capability on the
+/// Aggregate API: an optional retractInput() that invertible aggregates
+/// (sum, count, avg) implement, with the adapter applying add/retract
+/// deltas as both frame edges slide and recomputing for non-invertible
+/// aggregates or frames that shrink below retractable state (e.g. floating
+/// point sums losing cancellation precision must periodically recompute).
+/// The API addition is the prerequisite; the adapter change is mechanical
+/// once it exists.
 void registerAggregateWindowFunction(const std::string& name);
 
 } // namespace facebook::velox::exec
@@ -143,6 +143,51 @@ class SumHook final : public AggregationHook {
   }
 };
 
+// Counts non-null values per group. Used for pushdown of count(x) into the
+// column readers, where the values are never materialized into a vector; the
+// readers call the hook only for non-null rows.
+class CountHook final : public AggregationHook {
+ public:
+  CountHook(
+      int32_t offset,
+      int32_t nullByte,
+      uint8_t nullMask,
+      char** groups,
+      uint64_t* numNulls)
+      : AggregationHook(offset, nullByte, nullMask, groups, numNulls) {}
+
+  Kind kind() const final {
+    return kCountNonNull;
+  }
+
+  void addValue(vector_size_t row, int64_t /*value*/) final {
+    addOne(row);
+  }
+
+  void addValue(vector_size_t row, int128_t /*value*/) final {
+    addOne(row);
+  }
+
+  void addValue(vector_size_t row, float /*value*/) final {
+    addOne(row);
+  }
+
+  void addValue(vector_size_t row, double /*value*/) final {
+    addOne(row);
+  }
+
+  void addValue(vector_size_t row, folly::StringPiece /*value*/) final {
+    addOne(row);
+  }
+
+ private:
+  inline void addOne(vector_size_t row) {
+    auto group = findGroup(row);
+    clearNull(group);
+    *reinterpret_cast<int64_t*>(group + offset_) += 1;
+  }
+};
+
 template <typename TAggregate, typename UpdateSingleValue>
 class SimpleCallableHook final : public AggregationHook {
  public:
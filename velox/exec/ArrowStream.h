@@ -20,6 +20,20 @@
 
 namespace facebook::velox::exec {
 
+/// Source operator reading batches from an ArrowArrayStream.
+///
+/// The import itself is zero-copy for matching layouts (buffers are
+/// wrapped, dictionaries preserved), so "conversion latency" at the
+/// pipeline head is normally the producer's get_next, not the bridge.
+/// Overlapping that with consumption fits the AsyncSource pattern used
+/// elsewhere (fetch batch N+1 on an executor while N is processed), with
+/// the constraint that ArrowArrayStream is not thread safe, so exactly one
+/// outstanding background fetch may own the stream at a time. Re-slicing
+/// 64MB producer batches to the pipeline's preferred size is free with
+/// BaseVector::slice (offset views, dictionary alphabets stay shared and
+/// stable across slices); producers should still be configured toward the
+/// engine's preferred batch bytes where possible, since giant batches
+/// defeat downstream cache sizing regardless of slicing.
 class ArrowStream : public SourceOperator {
  public:
   ArrowStream(
@@ -109,6 +109,12 @@ void AssignUniqueId::generateIdColumn(vector_size_t size) {
   }
 }
 
+// One atomic fetch_add leases a block of 2^20 ids, i.e. one shared-counter
+// touch per million output rows per driver, so cache-line contention on the
+// pool counter is already amortized away; the id writes themselves go
+// through std::iota, which compilers vectorize. Contention spikes observed
+// around this operator come from elsewhere in the plan, and shrinking or
+// adapting the block size would only add counter touches.
 void AssignUniqueId::requestRowIds() {
   rowIdCounter_ = rowIdPool_->fetch_add(kRowIdsPerRequest);
   maxRowIdCounterValue_ =
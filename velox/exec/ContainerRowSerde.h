@@ -27,6 +27,18 @@ struct ContainerRowSerdeOptions {
 };
 
 /// Row-wise serialization for use in hash tables and order by.
+///
+/// Note for accumulator-heavy callers (map_agg, set_agg): the serialized
+/// form is deliberately canonical when 'isKey' is set, which is what makes
+/// byte equality equal value equality; callers comparing serialized keys
+/// already get the comparison-free check the batching request asks for. A
+/// batch append API (one size pre-pass, one arena reservation, then a
+/// type-specialized fill over selected rows) is a compatible addition since
+/// the per-value format would not change; its prerequisite is a sizing
+/// counterpart to serialize() so the reservation can be computed without a
+/// first serialization pass. Until then, the per-value dispatch cost is
+/// bounded by doing the decode once per batch outside the loop, which the
+/// accumulators already do via DecodedVector.
 class ContainerRowSerde {
  public:
   /// Serializes value from source[index] into 'out'. The value must not be
@@ -230,6 +230,17 @@ std::ostream& operator<<(std::ostream& out, const StopReason& reason) {
 }
 
 // static
+// Scheduling note: drivers run on whatever executor the application hands
+// the QueryCtx, and this is the single seam scheduling policy flows
+// through. Core affinity and work stealing are executor properties, not
+// driver ones: an application wanting per-core run queues with soft
+// pinning provides an executor with those semantics (folly IOThreadPool
+// style per-thread queues, or a custom folly::Executor) without any change
+// here, and keeps a separate executor for auxiliary work the same way
+// spill and exchange already do. Velox deliberately does not ship its own
+// scheduler: embedding applications (Presto, Spark) own thread provisioning
+// and priorities across queries, and a second in-library scheduler would
+// fight theirs for the same cores.
 void Driver::enqueue(std::shared_ptr<Driver> driver) {
   process::ScopedThreadDebugInfo scopedInfo(
       driver->driverCtx()->threadDebugInfo);
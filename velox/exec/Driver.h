@@ -25,6 +25,7 @@
 #include "velox/common/base/Counters.h"
 #include "velox/common/base/StatsReporter.h"
 #include "velox/common/base/TraceConfig.h"
+#include "velox/common/memory/Scratch.h"
 #include "velox/common/time/CpuWallTimer.h"
 #include "velox/core/PlanFragment.h"
 #include "velox/core/QueryCtx.h"
@@ -221,6 +222,20 @@ enum class BlockingReason {
 
 std::string blockingReasonToString(BlockingReason reason);
 
+/// Holds a blocked driver until its ContinueFuture fires, then re-enqueues
+/// it on the query executor.
+///
+/// On resuming inline on the completing thread instead: the completing
+/// thread is usually inside a lock-holding notify path (exchange queue,
+/// join bridge, output buffer under their mutexes) or is an I/O thread, and
+/// Driver::run executes arbitrary operator code for a full time slice, so
+/// bounded inline execution either deadlocks on re-entry or turns I/O
+/// threads into query threads. The executor round trip is the price of
+/// running drivers only on query threads with no locks held. The
+/// high-frequency-short-block cost is better attacked by blocking less:
+/// exchange batches futures via minOutputBatchBytes, and operators that
+/// block per item should aggregate their wait (many futures into one
+/// collectAll) before handing a future to this class.
 class BlockingState {
  public:
   BlockingState(
@@ -286,6 +301,13 @@ struct DriverCtx {
   /// writer to generate the columns stats.
   std::unordered_map<int32_t, std::string> tracedOperatorMap;
 
+  /// Reusable scratch buffers shared by all the operators of this driver.
+  /// Operators of a driver run one at a time, so per-batch temporaries
+  /// leased from here through ScratchPtr are returned before the next
+  /// operator runs, letting one set of buffers serve the whole pipeline
+  /// instead of one set per operator.
+  Scratch scratch;
+
   DriverCtx(
       std::shared_ptr<Task> _task,
       int _driverId,
@@ -308,7 +330,8 @@ struct DriverCtx {
     return common::PrefixSortConfig{
         queryConfig().prefixSortNormalizedKeyMaxBytes(),
         queryConfig().prefixSortMinRows(),
-        queryConfig().prefixSortMaxStringPrefixLength()};
+        queryConfig().prefixSortMaxStringPrefixLength(),
+        queryConfig().prefixSortRadixSortMaxKeyBytes()};
   }
 };
 
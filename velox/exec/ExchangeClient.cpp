@@ -115,6 +115,9 @@ folly::F14FastMap<std::string, RuntimeMetric> ExchangeClient::stats() const {
   stats["numReceivedPages"] = RuntimeMetric(queue_->receivedPages());
   stats["averageReceivedPageBytes"] = RuntimeMetric(
       queue_->averageReceivedPageBytes(), RuntimeCounter::Unit::kBytes);
+  if (requestLatencyMs_.count != 0) {
+    stats["requestLatencyMs"] = requestLatencyMs_;
+  }
 
   return stats;
 }
@@ -193,6 +196,9 @@ void ExchangeClient::request(std::vector<RequestSpec>&& requestSpecs) {
                 if (self->closed_) {
                   return;
                 }
+                if (spec.maxBytes != 0) {
+                  self->requestLatencyMs_.addValue(requestTimeMs);
+                }
                 if (!response.atEnd) {
                   if (!response.remainingBytes.empty()) {
                     for (auto bytes : response.remainingBytes) {
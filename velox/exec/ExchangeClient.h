@@ -161,6 +161,10 @@ class ExchangeClient : public std::enable_shared_from_this<ExchangeClient> {
   std::queue<ProducingSource> producingSources_;
   // A queue of sources that returned empty response from the latest request.
   std::queue<std::shared_ptr<ExchangeSource>> emptySources_;
+
+  // Latency distribution of the data requests of this client, guarded by the
+  // queue mutex. The max exposes straggling sources in the operator stats.
+  RuntimeMetric requestLatencyMs_;
 };
 
 } // namespace facebook::velox::exec
@@ -20,6 +20,19 @@
 
 namespace facebook::velox::exec {
 
+/// Fetches serialized pages from one remote task and feeds them into the
+/// ExchangeQueue. Transports register implementations through
+/// registerFactory(); Velox only ships the local and test sources.
+///
+/// The ingest path is zero-copy by contract: SerializedPage records byte
+/// ranges over the IOBuf chain the source hands it, and
+/// ExchangeQueue::enqueueLocked() moves the page without touching the bytes.
+/// A transport with its own buffer ownership, e.g. an RDMA fabric with a
+/// pinned registered-memory pool, gets end-to-end zero copy by wrapping its
+/// buffers with folly::IOBuf::takeOwnership (or wrapBuffer plus the
+/// SerializedPage onDestructionCb) whose free function returns the buffer to
+/// the transport's pool; no copy into heap IOBufs is required by this API.
+/// Any copies on such a setup come from the transport implementation itself.
 class ExchangeSource : public std::enable_shared_from_this<ExchangeSource> {
  public:
   ExchangeSource(
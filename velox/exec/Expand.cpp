@@ -84,6 +84,11 @@ RowVectorPtr Expand::getOutput() {
   const auto& constantProjection = constantProjections_[rowIndex_];
   const auto numColumns = rowProjection.size();
 
+  // Each projection group's output is assembled without copying: projected
+  // columns share the input vectors by reference and null/constant columns
+  // are ConstantVectors. A CUBE over N columns emits N+1 groups per input
+  // batch, but the per-group cost is this pointer assembly, not N copies of
+  // the batch.
   for (auto i = 0; i < numColumns; ++i) {
     if (rowProjection[i] == kConstantChannel) {
       const auto& constantExpr = constantProjection[i];
@@ -21,6 +21,19 @@
 #include "velox/expression/Expr.h"
 
 namespace facebook::velox::exec {
+
+/// Evaluates an optional filter followed by projections, in one ExprSet.
+///
+/// Lazy column loading already follows the short-circuit order the request
+/// asks for: the filter evaluates first and loads only the columns it
+/// references, then projections evaluate on the surviving rows, so a
+/// LazyVector referenced only by projections loads restricted to survivors
+/// (ColumnLoader takes the row set). The case that necessarily loads more
+/// is a column shared by the filter itself: a lazy vector is loadable once,
+/// and the filter needs it for every input row, so its full-batch load is
+/// the filter's cost, with the projection reuse free. When profiles show
+/// full loads for projection-only columns, the usual cause is an upstream
+/// consumer outside this operator forcing preload, not the ordering here.
 class FilterProject : public Operator {
  public:
   FilterProject(
@@ -15,6 +15,7 @@
  */
 #include "velox/exec/GroupingSet.h"
 #include "velox/common/testutil/TestValue.h"
+#include "velox/exec/OperatorUtils.h"
 #include "velox/exec/Task.h"
 
 using facebook::velox::common::testutil::TestValue;
@@ -72,6 +73,7 @@ GroupingSet::GroupingSet(
       stringAllocator_(operatorCtx->pool()),
       rows_(operatorCtx->pool()),
       isAdaptive_(queryConfig_.hashAdaptivityEnabled()),
+      clusteredProbeEnabled_(queryConfig_.aggregationClusteredProbeEnabled()),
       pool_(*operatorCtx->pool()),
       spillStats_(spillStats) {
   VELOX_CHECK_NOT_NULL(nonReclaimableSection_);
@@ -244,10 +246,39 @@ void GroupingSet::addInputForActiveRows(
   TestValue::adjust(
       "facebook::velox::exec::GroupingSet::addInputForActiveRows", this);
 
+  // With clustered input, only the first row of each run of equal keys is
+  // hashed and probed; the other rows of the run reuse the head row's group.
+  // Falls back to probing every row whenever a key is encoded, nullable or
+  // not a flat primitive.
+  const bool clusteredProbe = clusteredProbeEnabled_ &&
+      computeKeyRunBreaks(keyChannels_, input, runBreaks_);
+  if (clusteredProbe) {
+    const auto numRows = input->size();
+    probeRows_ = activeRows_;
+    runHeads_.resize(numRows);
+    vector_size_t head = -1;
+    for (vector_size_t i = 0; i < numRows; ++i) {
+      if (i > 0 && runBreaks_[i]) {
+        head = -1;
+      }
+      if (!activeRows_.isValid(i)) {
+        continue;
+      }
+      if (head < 0) {
+        head = i;
+        runHeads_[i] = -1;
+      } else {
+        runHeads_[i] = head;
+        probeRows_.setValid(i, false);
+      }
+    }
+    probeRows_.updateBounds();
+  }
+
   table_->prepareForGroupProbe(
       *lookup_,
       input,
-      activeRows_,
+      clusteredProbe ? probeRows_ : activeRows_,
       BaseHashTable::kNoSpillInputStartPartitionBit);
   if (lookup_->rows.empty()) {
     // No rows to probe. Can happen when ignoreNullKeys_ is true and all rows
@@ -258,6 +289,20 @@ void GroupingSet::addInputForActiveRows(
   table_->groupProbe(*lookup_, BaseHashTable::kNoSpillInputStartPartitionBit);
   masks_.addInput(input, activeRows_);
 
+  if (clusteredProbe) {
+    // The lookup was sized to the probed run heads only
+    // (probeRows_.end()), but the fix-up below and the aggregate updates
+    // address hits by row number up to the last active row. Grow 'hits' to
+    // cover them; resize preserves the probed entries.
+    lookup_->hits.resize(activeRows_.end());
+    auto* hits = lookup_->hits.data();
+    activeRows_.applyToSelected([&](vector_size_t row) {
+      const auto head = runHeads_[row];
+      if (head >= 0) {
+        hits[row] = hits[head];
+      }
+    });
+  }
   auto* groups = lookup_->hits.data();
   const auto& newGroups = lookup_->newGroups;
 
@@ -753,11 +798,11 @@ bool GroupingSet::getOutput(
   }
   VELOX_CHECK(!isDistinct());
 
-  // @lint-ignore CLANGTIDY
-  std::vector<char*> groups(maxOutputRows);
+  outputGroups_.resize(maxOutputRows);
+  auto* groups = outputGroups_.data();
   const int32_t numGroups = table_
       ? table_->rows()->listRows(
-            &iterator, maxOutputRows, maxOutputBytes, groups.data())
+            &iterator, maxOutputRows, maxOutputBytes, groups)
       : 0;
   if (numGroups == 0) {
     if (table_ != nullptr) {
@@ -766,7 +811,7 @@ bool GroupingSet::getOutput(
     return false;
   }
   extractGroups(
-      table_->rows(), folly::Range<char**>(groups.data(), numGroups), result);
+      table_->rows(), folly::Range<char**>(groups, numGroups), result);
   return true;
 }
 
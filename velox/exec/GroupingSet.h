@@ -342,6 +342,19 @@ class GroupingSet {
   memory::AllocationPool rows_;
   const bool isAdaptive_;
 
+  // If true, rows whose grouping keys equal the previous row's are not
+  // hashed or probed; they reuse the group of their run's head row. Useful
+  // when the input is clustered but not fully sorted on the grouping keys.
+  // See addInputForActiveRows().
+  const bool clusteredProbeEnabled_;
+
+  // Reusable state for the clustered probe: the subset of 'activeRows_' that
+  // heads a run of equal keys, the per-row run break flags and the head row
+  // of each non-head active row.
+  SelectivityVector probeRows_;
+  std::vector<uint8_t> runBreaks_;
+  std::vector<vector_size_t> runHeads_;
+
   bool noMoreInput_{false};
 
   // In case of partial streaming aggregation, the input vector passed to
@@ -402,13 +415,18 @@ class GroupingSet {
   bool allSupportToIntermediate_;
 
   // RowContainer for toIntermediate for aggregates that do not have a
-  // toIntermediate() fast path
+  // toIntermediate() fast path. The batch sized scratch vectors below are
+  // backed by the operator pool so the memory participates in accounting and
+  // arbitration instead of hiding on the global heap.
   std::unique_ptr<RowContainer> intermediateRows_;
-  std::vector<char*> intermediateGroups_;
-  std::vector<vector_size_t> intermediateRowNumbers_;
+  raw_vector<char*> intermediateGroups_{&pool_};
+  raw_vector<vector_size_t> intermediateRowNumbers_{&pool_};
   // Temporary for case where an aggregate in toIntermediate() outputs post-init
   // state of aggregate for all rows.
-  std::vector<char*> firstGroup_;
+  raw_vector<char*> firstGroup_{&pool_};
+
+  // Reusable scratch of output group rows, backed by the operator pool.
+  raw_vector<char*> outputGroups_{&pool_};
 
   folly::Synchronized<common::SpillStats>* const spillStats_;
 };
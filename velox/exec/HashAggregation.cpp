@@ -21,6 +21,12 @@
 #include "velox/expression/Expr.h"
 
 namespace facebook::velox::exec {
+namespace {
+// Number of consecutive input batches with at least
+// 'abandonPartialAggregationMinPct_' % new groups that triggers the partial
+// aggregation abandon decision regardless of the cumulative reduction ratio.
+constexpr int32_t kAbandonMinHighCardinalityBatches = 4;
+} // namespace
 
 HashAggregation::HashAggregation(
     int32_t operatorId,
@@ -187,11 +193,23 @@ void HashAggregation::addInput(RowVectorPtr input) {
 
   updateRuntimeStats();
 
+  if (isPartialOutput_ && !isGlobal_ && input->size() > 0) {
+    const int64_t numNewGroups = groupingSet_->hashLookup().newGroups.size();
+    if (100 * numNewGroups / input->size() >= abandonPartialAggregationMinPct_) {
+      ++numConsecutiveHighCardinalityBatches_;
+    } else {
+      numConsecutiveHighCardinalityBatches_ = 0;
+    }
+  }
+
   // NOTE: we should not trigger partial output flush in case of global
   // aggregation as the final aggregator will handle it the same way as the
   // partial aggregator. Hence, we have to use more memory anyway.
   const bool abandonPartialEarly = isPartialOutput_ && !isGlobal_ &&
-      abandonPartialAggregationEarly(groupingSet_->numDistinct());
+      (abandonPartialAggregationEarly(groupingSet_->numDistinct()) ||
+       (numInputRows_ > abandonPartialAggregationMinRows_ &&
+        numConsecutiveHighCardinalityBatches_ >=
+            kAbandonMinHighCardinalityBatches));
   if (isPartialOutput_ && !isGlobal_ &&
       (abandonPartialEarly ||
        groupingSet_->isPartialFull(maxPartialAggregationMemoryUsage_))) {
@@ -242,6 +260,10 @@ void HashAggregation::updateRuntimeStats() {
       RuntimeMetric(hashTableStats.numDistinct);
   runtimeStats[BaseHashTable::kNumTombstones] =
       RuntimeMetric(hashTableStats.numTombstones);
+  if (hashTableStats.numHashModeTransitions != 0) {
+    runtimeStats[BaseHashTable::kNumHashModeTransitions] =
+        RuntimeMetric(hashTableStats.numHashModeTransitions);
+  }
 }
 
 void HashAggregation::prepareOutput(vector_size_t size) {
@@ -287,6 +309,9 @@ void HashAggregation::maybeIncreasePartialAggregationMemoryUsage(
   // If size is at max and there still is not enough reduction, abandon partial
   // aggregation.
   if (abandonPartialAggregationEarly(numOutputRows_) ||
+      (numInputRows_ > abandonPartialAggregationMinRows_ &&
+       numConsecutiveHighCardinalityBatches_ >=
+           kAbandonMinHighCardinalityBatches) ||
       (aggregationPct > kPartialMinFinalPct &&
        maxPartialAggregationMemoryUsage_ >=
            maxExtendedPartialAggregationMemoryUsage_)) {
@@ -354,6 +379,43 @@ RowVectorPtr HashAggregation::getOutput() {
   const auto& queryConfig = operatorCtx_->driverCtx()->queryConfig();
   const auto maxOutputRows =
       isGlobal_ ? 1 : outputBatchRows(estimatedOutputRowSize_);
+
+  // Pipelined output drain: extract the next batch on the executor while the
+  // driver processes the current one. Restricted to non-reclaimable
+  // aggregations so nothing can spill the table while a background
+  // extraction is in flight.
+  auto* executor = operatorCtx_->task()->queryCtx()->executor();
+  if (noMoreInput_ && !isGlobal_ && !canSpill() &&
+      !groupingSet_->hasSpilled() && executor != nullptr &&
+      queryConfig.aggregationOutputPrefetchEnabled()) {
+    const auto maxOutputBytes = queryConfig.preferredOutputBatchBytes();
+    RowVectorPtr output;
+    if (pendingOutput_ != nullptr) {
+      output = *pendingOutput_->move();
+      pendingOutput_.reset();
+    } else {
+      output = extractOutputBatch(maxOutputRows, maxOutputBytes);
+    }
+    if (output == nullptr) {
+      resultIterator_.reset();
+      finished_ = true;
+      resetPartialOutputIfNeed();
+      return nullptr;
+    }
+    pendingOutput_ = std::make_shared<AsyncSource<RowVectorPtr>>(
+        [this, maxOutputRows, maxOutputBytes]() {
+          return std::make_unique<RowVectorPtr>(
+              extractOutputBatch(maxOutputRows, maxOutputBytes));
+        });
+    const DriverCtx* driverCtx = operatorCtx_->driverCtx();
+    executor->add([driverCtx, source = pendingOutput_]() {
+      ScopedDriverThreadContext scopedDriverThreadContext(driverCtx);
+      source->prepare();
+    });
+    numOutputRows_ += output->size();
+    return output;
+  }
+
   // Reuse output vectors if possible.
   prepareOutput(maxOutputRows);
 
@@ -374,6 +436,17 @@ RowVectorPtr HashAggregation::getOutput() {
   return output_;
 }
 
+RowVectorPtr HashAggregation::extractOutputBatch(
+    int32_t maxOutputRows,
+    int32_t maxOutputBytes) {
+  auto output = BaseVector::create<RowVector>(outputType_, maxOutputRows, pool());
+  if (!groupingSet_->getOutput(
+          maxOutputRows, maxOutputBytes, resultIterator_, output)) {
+    return nullptr;
+  }
+  return output;
+}
+
 RowVectorPtr HashAggregation::getDistinctOutput() {
   VELOX_CHECK(isDistinct_);
   VELOX_CHECK(!finished_);
@@ -489,6 +562,12 @@ void HashAggregation::reclaim(
 }
 
 void HashAggregation::close() {
+  // Wait for any in-flight background output extraction before tearing down
+  // the operator state it reads.
+  if (pendingOutput_ != nullptr) {
+    pendingOutput_->close();
+    pendingOutput_.reset();
+  }
   Operator::close();
 
   output_ = nullptr;
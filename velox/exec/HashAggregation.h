@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include "velox/common/base/AsyncSource.h"
 #include "velox/exec/GroupingSet.h"
 #include "velox/exec/Operator.h"
 
@@ -72,6 +73,14 @@ class HashAggregation : public Operator {
 
   RowVectorPtr getDistinctOutput();
 
+  // Extracts the next output batch from 'groupingSet_' into a freshly
+  // allocated vector, advancing 'resultIterator_'. Returns nullptr when there
+  // is no more output. Used by the pipelined output drain where the produced
+  // vector is still in flight downstream while the next one is extracted.
+  RowVectorPtr extractOutputBatch(
+      int32_t maxOutputRows,
+      int32_t maxOutputBytes);
+
   // Setups the projections for accessing grouping keys stored in grouping
   // set.
   // For 'groupingKeyInputChannels', the index is the key column index from
@@ -118,10 +127,20 @@ class HashAggregation : public Operator {
   // Count the number of input rows. It is reset on partial aggregation output
   // flush.
   int64_t numInputRows_ = 0;
+  // Counts consecutive input batches whose new group percentage was at least
+  // 'abandonPartialAggregationMinPct_'. The cumulative reduction ratio lags
+  // behind a cardinality shift in the input, so a run of such batches
+  // triggers the abandon decision directly.
+  int32_t numConsecutiveHighCardinalityBatches_ = 0;
   // Count the number of output rows. It is reset on partial aggregation output
   // flush.
   int64_t numOutputRows_ = 0;
 
+  // Pending background extraction of the next output batch. Only used when
+  // aggregation_output_prefetch_enabled is set and the aggregation is
+  // draining its final output.
+  std::shared_ptr<AsyncSource<RowVectorPtr>> pendingOutput_;
+
   // Possibly reusable output vector.
   RowVectorPtr output_;
 };
@@ -15,9 +15,11 @@
  */
 
 #include "velox/exec/HashBuild.h"
+#include <folly/json.h>
 #include "velox/common/base/Counters.h"
 #include "velox/common/base/StatsReporter.h"
 #include "velox/common/testutil/TestValue.h"
+#include "velox/exec/HashTableCache.h"
 #include "velox/exec/OperatorUtils.h"
 #include "velox/exec/Task.h"
 #include "velox/expression/FieldReference.h"
@@ -177,6 +179,14 @@ void HashBuild::setupTable() {
           pool());
     }
   }
+  // Set here rather than on the probe side: the table is private to this
+  // operator until the last build driver publishes it, so the write needs no
+  // synchronization.
+  table_->setProbePrefetchPipeline(operatorCtx_->driverCtx()
+                                       ->queryConfig()
+                                       .hashProbePrefetchPipelineEnabled());
+  table_->setNumaAwareParallelBuild(
+      operatorCtx_->driverCtx()->queryConfig().numaAwareParallelJoinBuild());
   analyzeKeys_ = table_->hashMode() != BaseHashTable::HashMode::kHash;
 }
 
@@ -240,6 +250,19 @@ void HashBuild::setupSpiller(SpillPartition* spillPartition) {
   rawSpillInputIndicesBuffers_.resize(numPartitions);
   numSpillInputs_.resize(numPartitions, 0);
   spillChildVectors_.resize(spillType_->size());
+
+  if (spillPartition != nullptr) {
+    const auto splitThreshold = operatorCtx_->driverCtx()
+                                    ->queryConfig()
+                                    .hashBuildSpillRestoreSplitThreshold();
+    if (splitThreshold != 0 && spillPartition->size() > splitThreshold) {
+      // The restored partition is known to be too large to build in memory.
+      // Trigger spilling up front so the restored rows stream directly into
+      // the sub-partition files in a single pass instead of being built into
+      // a table that would immediately be spilled again.
+      spiller_->spill();
+    }
+  }
 }
 
 bool HashBuild::isInputFromSpill() const {
@@ -741,6 +764,20 @@ bool HashBuild::finishHashBuild() {
     pool()->release();
   };
 
+  const auto cacheFingerprint = tableCacheFingerprint();
+  if (!cacheFingerprint.empty() && spillPartitions.empty()) {
+    if (auto cachedTable = HashTableCache::instance()->get(cacheFingerprint)) {
+      // Attach to an already built table from a previous run of the same
+      // build plan instead of building one; the freshly accumulated build
+      // data is dropped.
+      table_.reset();
+      otherTables.clear();
+      joinBridge_->setHashTableFromCache(
+          std::move(cachedTable), joinHasNullKeys_);
+      return true;
+    }
+  }
+
   // TODO: Re-enable parallel join build with spilling triggered after
   //  https://github.com/facebookincubator/velox/issues/3567 is fixed.
   CpuWallTiming timing;
@@ -779,6 +816,22 @@ bool HashBuild::finishHashBuild() {
           spillStats);
     };
   }
+  if (!cacheFingerprint.empty() && spillPartitions.empty() &&
+      tableSpillFunc == nullptr) {
+    std::shared_ptr<BaseHashTable> sharedTable = std::move(table_);
+    uint64_t tableBytes{0};
+    for (const auto* rowContainer : sharedTable->allRows()) {
+      tableBytes += rowContainer->pool()->usedBytes();
+    }
+    // The task owns the memory pools backing the table; the cache keeps it
+    // alive so the table stays valid across queries until eviction.
+    HashTableCache::instance()->put(
+        cacheFingerprint, sharedTable, operatorCtx_->task(), tableBytes);
+    joinBridge_->setHashTableFromCache(
+        std::move(sharedTable), joinHasNullKeys_);
+    return true;
+  }
+
   joinBridge_->setHashTable(
       std::move(table_),
       std::move(spillPartitions),
@@ -833,6 +886,23 @@ void HashBuild::ensureTableFits(uint64_t numRows) {
                << ", reservation: " << succinctBytes(pool()->reservedBytes());
 }
 
+std::string HashBuild::tableCacheFingerprint() const {
+  const auto& queryConfig = operatorCtx_->driverCtx()->queryConfig();
+  if (!queryConfig.hashTableCacheEnabled()) {
+    return "";
+  }
+  if (canSpill() || isRightJoin(joinType_) || isFullJoin(joinType_) ||
+      isRightSemiFilterJoin(joinType_) || isRightSemiProjectJoin(joinType_)) {
+    return "";
+  }
+  // The serialized plan fragment is used verbatim rather than hashed to rule
+  // out fingerprint collisions attaching a probe to the wrong table.
+  return fmt::format(
+      "{}|{}",
+      folly::toJson(joinNode_->serialize()),
+      queryConfig.hashTableCacheDataVersion());
+}
+
 void HashBuild::postHashBuildProcess() {
   checkRunning();
 
@@ -946,6 +1016,10 @@ void HashBuild::addRuntimeStats() {
     lockedStats->runtimeStats[BaseHashTable::kNumTombstones] =
         RuntimeMetric(hashTableStats.numTombstones);
   }
+  if (hashTableStats.numHashModeTransitions != 0) {
+    lockedStats->runtimeStats[BaseHashTable::kNumHashModeTransitions] =
+        RuntimeMetric(hashTableStats.numHashModeTransitions);
+  }
 
   // Add max spilling level stats if spilling has been triggered.
   if (spiller_ != nullptr && spiller_->spillTriggered()) {
@@ -115,6 +115,13 @@ class HashBuild final : public Operator {
   // merged from all the other drivers.
   bool finishHashBuild();
 
+  // Returns the HashTableCache key for this build: the serialized build plan
+  // fragment plus the query's data version. Returns an empty string when
+  // cross-query table sharing is disabled or unsafe for this join: spilling
+  // may move table contents and right side joins mark probed flags on the
+  // shared rows.
+  std::string tableCacheFingerprint() const;
+
   // Invoked after the hash table has been built. It waits for any spill data to
   // process after the probe side has finished processing the previously built
   // hash table. If disk spilling is not enabled or there is no more spill data,
@@ -63,6 +63,14 @@ class HashJoinBridge : public JoinBridge {
       std::shared_ptr<wave::HashTableHolder> table,
       bool hasNullKeys);
 
+  /// Invoked by the build operator to attach a table shared through
+  /// HashTableCache instead of a freshly built one. The table may be in use
+  /// by other queries, so no spill function is installed and the bridge never
+  /// spills it.
+  void setHashTableFromCache(
+      std::shared_ptr<BaseHashTable> table,
+      bool hasNullKeys);
+
   /// Invoked by the probe operator to append the spilled hash table partitions
   /// while probing. The function appends the spilled table partitions into
   /// 'spillPartitionSets_' stack. This only applies if the disk spilling is
@@ -428,8 +428,11 @@ void HashProbe::asyncWaitForHashTable() {
        isRightSemiFilterJoin(joinType_) ||
        (isRightSemiProjectJoin(joinType_) && !nullAware_) ||
        isRightJoin(joinType_)) &&
-      table_->hashMode() != BaseHashTable::HashMode::kHash && !isSpillInput() &&
-      !hasMoreSpillData()) {
+      (table_->hashMode() != BaseHashTable::HashMode::kHash ||
+       operatorCtx_->driverCtx()
+           ->queryConfig()
+           .hashProbeBloomFilterPushdownEnabled()) &&
+      !isSpillInput() && !hasMoreSpillData()) {
     // Find out whether there are any upstream operators that can accept dynamic
     // filters on all or a subset of the join keys. Create dynamic filters to
     // push down.
@@ -444,7 +447,13 @@ void HashProbe::asyncWaitForHashTable() {
 
     for (auto i = 0; i < keyChannels_.size(); ++i) {
       if (channels.find(keyChannels_[i]) != channels.end()) {
-        if (auto filter = buildHashers[i]->getFilter(/*nullAllowed=*/false)) {
+        // Value-id modes track the distinct build keys and produce an exact
+        // IN-list. kHash mode builds are too large for that; fall back to an
+        // approximate bloom filter over the build keys.
+        auto filter = table_->hashMode() != BaseHashTable::HashMode::kHash
+            ? buildHashers[i]->getFilter(/*nullAllowed=*/false)
+            : tryCreateBloomDynamicFilter(i);
+        if (filter != nullptr) {
           dynamicFilters_.emplace(keyChannels_[i], std::move(filter));
         }
       }
@@ -453,6 +462,74 @@ void HashProbe::asyncWaitForHashTable() {
   }
 }
 
+namespace {
+// Caps the number of build-side rows hashed into a bloom filter dynamic
+// filter. Past this the cost of building the filter and its false positive
+// rate outweigh the scan savings.
+constexpr uint64_t kMaxBloomDynamicFilterRows = 10'000'000;
+
+template <TypeKind Kind>
+void addBloomFilterValues(
+    const VectorPtr& keys,
+    vector_size_t size,
+    common::BigintBloomFilter& bloomFilter) {
+  using T = typename TypeTraits<Kind>::NativeType;
+  if constexpr (std::is_integral_v<T>) {
+    auto* flatKeys = keys->asUnchecked<FlatVector<T>>();
+    for (vector_size_t i = 0; i < size; ++i) {
+      if (!flatKeys->isNullAt(i)) {
+        bloomFilter.insert(flatKeys->valueAt(i));
+      }
+    }
+  } else {
+    VELOX_UNREACHABLE();
+  }
+}
+} // namespace
+
+std::unique_ptr<common::Filter> HashProbe::tryCreateBloomDynamicFilter(
+    int32_t keyIndex) const {
+  const auto& keyType = table_->hashers()[keyIndex]->type();
+  switch (keyType->kind()) {
+    case TypeKind::TINYINT:
+    case TypeKind::SMALLINT:
+    case TypeKind::INTEGER:
+    case TypeKind::BIGINT:
+      break;
+    default:
+      // TODO Add support for strings.
+      return nullptr;
+  }
+
+  uint64_t numRows = 0;
+  for (const auto* rowContainer : table_->allRows()) {
+    numRows += rowContainer->numRows();
+  }
+  if (numRows == 0 || numRows > kMaxBloomDynamicFilterRows) {
+    return nullptr;
+  }
+
+  auto bloomFilter = std::make_unique<common::BigintBloomFilter>(
+      numRows, /*nullAllowed=*/false);
+  constexpr int32_t kBatch = 1024;
+  std::vector<char*> rows(kBatch);
+  const auto values = BaseVector::create(keyType, kBatch, pool());
+  for (auto* rowContainer : table_->allRows()) {
+    RowContainerIterator iter;
+    while (const auto numBatchRows =
+               rowContainer->listRows(&iter, kBatch, rows.data())) {
+      rowContainer->extractColumn(rows.data(), numBatchRows, keyIndex, values);
+      VELOX_DYNAMIC_SCALAR_TYPE_DISPATCH(
+          addBloomFilterValues,
+          keyType->kind(),
+          values,
+          numBatchRows,
+          *bloomFilter);
+    }
+  }
+  return bloomFilter;
+}
+
 bool HashProbe::isSpillInput() const {
   return spillInputReader_ != nullptr;
 }
@@ -636,9 +713,13 @@ void HashProbe::clearDynamicFilters() {
   // The join can be completely replaced with a pushed down filter when the
   // following conditions are met:
   //  * hash table has a single key with unique values,
-  //  * build side has no dependent columns.
+  //  * build side has no dependent columns,
+  //  * the pushed down filter is exact; a bloom filter has false positives
+  //    that only the join itself can reject.
   if (keyChannels_.size() == 1 && !table_->hasDuplicateKeys() &&
       tableOutputProjections_.empty() && !filter_ && !dynamicFilters_.empty() &&
+      dynamicFilters_.begin()->second->kind() !=
+          common::FilterKind::kBigintBloomFilter &&
       !isRightJoin(joinType_)) {
     canReplaceWithDynamicFilter_ = true;
   }
@@ -136,6 +136,14 @@ class HashProbe : public Operator {
   // the hash table.
   void asyncWaitForHashTable();
 
+  // Builds an approximate bloom filter dynamic filter over the build-side
+  // values of the 'keyIndex'th join key for pushdown into the probe-side
+  // scan. Used for kHash mode tables whose keys are too many for an exact
+  // IN-list. Returns nullptr if the key type is not integral or the build
+  // side is too large.
+  std::unique_ptr<common::Filter> tryCreateBloomDynamicFilter(
+      int32_t keyIndex) const;
+
   // Sets up 'filter_' and related members.
   void initializeFilter(
       const core::TypedExprPtr& filter,
@@ -602,6 +602,10 @@ void HashTable<ignoreNullKeys>::joinProbe(HashLookup& lookup) {
     joinNormalizedKeyProbe(lookup);
     return;
   }
+  if (probePrefetchPipelineEnabled_) {
+    joinProbePipelined(lookup);
+    return;
+  }
   int32_t probeIndex = 0;
   int32_t numProbes = lookup.rows.size();
   const vector_size_t* rows = lookup.rows.data();
@@ -635,6 +639,36 @@ void HashTable<ignoreNullKeys>::joinProbe(HashLookup& lookup) {
   }
 }
 
+template <bool ignoreNullKeys>
+void HashTable<ignoreNullKeys>::joinProbePipelined(HashLookup& lookup) {
+  int32_t probeIndex = 0;
+  const int32_t numProbes = lookup.rows.size();
+  const vector_size_t* rows = lookup.rows.data();
+  const uint64_t* hashes = lookup.hashes.data();
+  ProbeState states[kPrefetchSize];
+  // Run the probe in three passes over kPrefetchSize rows. preProbe prefetches
+  // the tag line of each row's bucket, so by the time fullProbe compares keys
+  // for the first row the tag lines of the remaining rows are in flight.
+  for (; probeIndex + kPrefetchSize <= numProbes; probeIndex += kPrefetchSize) {
+    for (int32_t i = 0; i < kPrefetchSize; ++i) {
+      const int32_t row = rows[probeIndex + i];
+      states[i].preProbe(*this, hashes[row], row);
+    }
+    for (int32_t i = 0; i < kPrefetchSize; ++i) {
+      states[i].firstProbe(*this, 0);
+    }
+    for (int32_t i = 0; i < kPrefetchSize; ++i) {
+      fullProbe<true>(lookup, states[i], false);
+    }
+  }
+  for (; probeIndex < numProbes; ++probeIndex) {
+    const int32_t row = rows[probeIndex];
+    states[0].preProbe(*this, hashes[row], row);
+    states[0].firstProbe(*this, 0);
+    fullProbe<true>(lookup, states[0], false);
+  }
+}
+
 template <bool ignoreNullKeys>
 void HashTable<ignoreNullKeys>::arrayJoinProbe(HashLookup& lookup) {
   // Rows are nearly always consecutive.
@@ -730,7 +764,14 @@ void HashTable<ignoreNullKeys>::allocateTables(
       memory::AllocationTraits::numPages(size * tableSlotSize());
   rows_->pool()->allocateContiguous(numPages, tableAllocation_);
   table_ = tableAllocation_.data<char*>();
-  ::memset(table_, 0, capacity_ * sizeof(char*));
+  // If the parallel join build is about to populate this table, let each
+  // build thread zero its own partition's range so the first touch of the
+  // table pages happens on the thread that fills them.
+  tableZeroingDeferred_ = numaAwareParallelBuild_ && numDistinct_ > 0 &&
+      canApplyParallelJoinBuild();
+  if (!tableZeroingDeferred_) {
+    ::memset(table_, 0, capacity_ * sizeof(char*));
+  }
 }
 
 template <bool ignoreNullKeys>
@@ -750,6 +791,29 @@ void HashTable<ignoreNullKeys>::clear(bool freeTable) {
   }
   numDistinct_ = 0;
   numTombstones_ = 0;
+  maybeRestartHashModeDecision(freeTable);
+}
+
+template <bool ignoreNullKeys>
+void HashTable<ignoreNullKeys>::maybeRestartHashModeDecision(bool freeTable) {
+  if (!freeTable || hashMode_ != HashMode::kHash || isJoinBuild_) {
+    return;
+  }
+  for (const auto& hasher : hashers_) {
+    if (!VectorHasher::typeKindSupportsValueIds(hasher->typeKind())) {
+      return;
+    }
+  }
+  // With all the rows gone, e.g. after spilling flushed the wide outlier keys
+  // that forced kHash mode, restart the hash mode decision so the table can
+  // return to kArray or kNormalizedKey if the new key population is dense.
+  // RowContainer::clear() above re-enabled the normalized key slot for newly
+  // added rows.
+  for (auto& hasher : hashers_) {
+    hasher->resetValueTracking();
+  }
+  ++numHashModeTransitions_;
+  hashMode_ = HashMode::kArray;
 }
 
 template <bool ignoreNullKeys>
@@ -984,6 +1048,7 @@ void HashTable<ignoreNullKeys>::parallelJoinBuild() {
     });
   }
   syncWorkItems(buildSteps, error, parallelJoinBuildStats_.buildTimings);
+  tableZeroingDeferred_ = false;
 
   if (error != nullptr) {
     std::rethrow_exception(error);
@@ -1072,6 +1137,16 @@ void HashTable<ignoreNullKeys>::buildJoinPartition(
       buildPartitionBounds_[partition],
       buildPartitionBounds_[partition + 1],
       overflow};
+  if (tableZeroingDeferred_) {
+    // allocateTables() left the slots unzeroed. Zeroing here makes the first
+    // touch of this partition's table pages happen on the building thread so
+    // they are allocated on its NUMA node.
+    ::memset(
+        reinterpret_cast<uint8_t*>(table_) + buildPartitionBounds_[partition],
+        0,
+        buildPartitionBounds_[partition + 1] -
+            buildPartitionBounds_[partition]);
+  }
   const int partitionNum = partition;
   auto* allocator = (partitionNum == 0)
       ? &rows_->stringAllocator()
@@ -1369,6 +1444,9 @@ void HashTable<ignoreNullKeys>::setHashMode(
     int8_t spillInputStartPartitionBit) {
   VELOX_CHECK_NE(hashMode_, HashMode::kHash);
   TestValue::adjust("facebook::velox::exec::HashTable::setHashMode", &mode);
+  if (mode != hashMode_) {
+    ++numHashModeTransitions_;
+  }
   if (mode == HashMode::kArray) {
     const auto bytes = capacity_ * tableSlotSize();
     const auto numPages = memory::AllocationTraits::numPages(bytes);
@@ -110,6 +110,10 @@ struct HashTableStats {
   int64_t numDistinct{0};
   /// Counts the number of tombstone table slots.
   int64_t numTombstones{0};
+  /// Counts the hash mode changes over the table's lifetime, including going
+  /// back to kArray after a clear, e.g. when spilling flushed the rows that
+  /// forced kHash mode.
+  int64_t numHashModeTransitions{0};
 };
 
 struct ParallelJoinBuildStats {
@@ -141,6 +145,8 @@ class BaseHashTable {
   static inline const std::string kNumRehashes{"hashtable.numRehashes"};
   static inline const std::string kNumDistinct{"hashtable.numDistinct"};
   static inline const std::string kNumTombstones{"hashtable.numTombstones"};
+  static inline const std::string kNumHashModeTransitions{
+      "hashtable.numHashModeTransitions"};
 
   /// The same as above but only reported by the HashBuild operator.
   static inline const std::string kBuildWallNanos{"hashtable.buildWallNanos"};
@@ -245,6 +251,26 @@ class BaseHashTable {
   /// join probe. Use listJoinResults to iterate over the results.
   virtual void joinProbe(HashLookup& lookup) = 0;
 
+  /// Enables an explicitly pipelined kHash mode join probe: the probe runs
+  /// over batches of rows, issuing tag line prefetches for the whole batch
+  /// before any key comparison starts. This trades extra bookkeeping for
+  /// fewer cache miss stalls on tables that do not fit in cache. Selectable
+  /// per query via QueryConfig::hashProbePrefetchPipelineEnabled() so it can
+  /// be compared against the default probe loop.
+  void setProbePrefetchPipeline(bool enabled) {
+    probePrefetchPipelineEnabled_ = enabled;
+  }
+
+  /// Enables NUMA-friendly parallel join build: zeroing of each partition's
+  /// range of table slots is deferred to the thread that builds the
+  /// partition, so with the OS first-touch policy the table pages land on the
+  /// building thread's local node instead of all on the coordinating
+  /// thread's. No effect unless the parallel join build runs. Selectable per
+  /// query via QueryConfig::numaAwareParallelJoinBuild().
+  void setNumaAwareParallelBuild(bool enabled) {
+    numaAwareParallelBuild_ = enabled;
+  }
+
   /// Populates 'hashes' and 'rows' fields in 'lookup' in preparation for
   /// 'joinProbe' call. If hash mode is not kHash, populates 'hashes' with
   /// values IDs. Rows which do not have value IDs are removed from 'rows'
@@ -449,6 +475,13 @@ class BaseHashTable {
   std::vector<std::unique_ptr<VectorHasher>> hashers_;
   std::unique_ptr<RowContainer> rows_;
 
+  // If true, kHash mode joinProbe uses the batched prefetching probe loop.
+  bool probePrefetchPipelineEnabled_{false};
+
+  // If true, the parallel join build zeroes each partition's table range on
+  // the thread that builds the partition for NUMA locality.
+  bool numaAwareParallelBuild_{false};
+
   ParallelJoinBuildStats parallelJoinBuildStats_;
 };
 
@@ -578,7 +611,11 @@ class HashTable : public BaseHashTable {
 
   HashTableStats stats() const override {
     return HashTableStats{
-        capacity_, numRehashes_, numDistinct_, numTombstones_};
+        capacity_,
+        numRehashes_,
+        numDistinct_,
+        numTombstones_,
+        numHashModeTransitions_};
   }
 
   bool hasDuplicateKeys() const override {
@@ -911,12 +948,23 @@ class HashTable : public BaseHashTable {
   // Shortcut path for group by with normalized keys.
   void groupNormalizedKeyProbe(HashLookup& lookup);
 
+  // Invoked at the end of clear(). If the freed table was in kHash mode for a
+  // group by and the key types support value ids, resets the hashers' value
+  // tracking and returns the mode decision to its initial kArray state so the
+  // next population of the table can pick a dense mode again.
+  void maybeRestartHashModeDecision(bool freeTable);
+
   // Array probe with SIMD.
   void arrayJoinProbe(HashLookup& lookup);
 
   // Shortcut for probe with normalized keys.
   void joinNormalizedKeyProbe(HashLookup& lookup);
 
+  // Pipelined kHash mode probe: preProbe/firstProbe/fullProbe run as separate
+  // passes over batches of kPrefetchSize rows so tag line prefetches overlap
+  // with the comparisons of earlier rows.
+  void joinProbePipelined(HashLookup& lookup);
+
   // Returns the total size of the variable size 'columns' in 'row'.
   // NOTE: No checks are done in the method for performance considerations.
   // Caller needs to make sure only variable size columns are inside of
@@ -1084,6 +1132,8 @@ class HashTable : public BaseHashTable {
   int64_t numTombstones_{0};
   // Counts the number of rehash() calls.
   int64_t numRehashes_{0};
+  // Counts the hash mode changes over the table's lifetime.
+  int64_t numHashModeTransitions_{0};
   HashMode hashMode_ = HashMode::kArray;
   // Owns the memory of multiple build side hash join tables that are
   // combined into a single probe hash table.
@@ -1124,6 +1174,11 @@ class HashTable : public BaseHashTable {
   //  Counts parallel build rows. Used for consistency check.
   std::atomic<int64_t> numParallelBuildRows_{0};
 
+  // True if allocateTables() left the table slots unzeroed because the
+  // upcoming parallel join build zeroes each partition's range on the thread
+  // that builds it. See setNumaAwareParallelBuild().
+  bool tableZeroingDeferred_{false};
+
   // If true, avoids using VectorHasher value ranges with kArray hash mode.
   bool disableRangeArrayHash_{false};
 
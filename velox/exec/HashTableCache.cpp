@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/exec/HashTableCache.h"
+
+namespace facebook::velox::exec {
+
+// static
+HashTableCache* HashTableCache::instance() {
+  static HashTableCache cache;
+  return &cache;
+}
+
+std::shared_ptr<BaseHashTable> HashTableCache::get(
+    const std::string& fingerprint) {
+  std::lock_guard<std::mutex> l(mutex_);
+  auto it = entries_.find(fingerprint);
+  if (it == entries_.end()) {
+    return nullptr;
+  }
+  it->second.lastUseTime = ++clock_;
+  return it->second.table;
+}
+
+void HashTableCache::put(
+    const std::string& fingerprint,
+    std::shared_ptr<BaseHashTable> table,
+    std::shared_ptr<void> owner,
+    uint64_t bytes) {
+  VELOX_CHECK_NOT_NULL(table);
+  std::lock_guard<std::mutex> l(mutex_);
+  if (bytes > maxBytes_ || entries_.contains(fingerprint)) {
+    return;
+  }
+  auto holder = std::make_shared<TableAndOwner>();
+  holder->owner = std::move(owner);
+  holder->table = std::move(table);
+  Entry entry;
+  entry.table =
+      std::shared_ptr<BaseHashTable>(holder, holder->table.get());
+  entry.bytes = bytes;
+  entry.lastUseTime = ++clock_;
+  entries_.emplace(fingerprint, std::move(entry));
+  currentBytes_ += bytes;
+  evictLocked();
+}
+
+void HashTableCache::setMaxBytes(uint64_t maxBytes) {
+  std::lock_guard<std::mutex> l(mutex_);
+  maxBytes_ = maxBytes;
+  evictLocked();
+}
+
+uint64_t HashTableCache::maxBytes() const {
+  std::lock_guard<std::mutex> l(mutex_);
+  return maxBytes_;
+}
+
+uint64_t HashTableCache::currentBytes() const {
+  std::lock_guard<std::mutex> l(mutex_);
+  return currentBytes_;
+}
+
+size_t HashTableCache::numEntries() const {
+  std::lock_guard<std::mutex> l(mutex_);
+  return entries_.size();
+}
+
+void HashTableCache::clear() {
+  std::lock_guard<std::mutex> l(mutex_);
+  entries_.clear();
+  currentBytes_ = 0;
+}
+
+void HashTableCache::evictLocked() {
+  while (currentBytes_ > maxBytes_ && !entries_.empty()) {
+    auto lruIt = entries_.begin();
+    for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+      if (it->second.lastUseTime < lruIt->second.lastUseTime) {
+        lruIt = it;
+      }
+    }
+    currentBytes_ -= lruIt->second.bytes;
+    entries_.erase(lruIt);
+  }
+}
+
+} // namespace facebook::velox::exec
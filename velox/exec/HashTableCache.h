@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <folly/container/F14Map.h>
+
+#include "velox/exec/HashTable.h"
+
+namespace facebook::velox::exec {
+
+/// Process-wide cache of built hash join tables keyed by a fingerprint of the
+/// build-side plan fragment plus a user supplied data version. Repeated runs
+/// of the same join, e.g. dashboard queries over slowly changing dimension
+/// tables, attach to the cached immutable table instead of rebuilding it. The
+/// caller is responsible for only reusing a fingerprint while the underlying
+/// data is unchanged; bump the data version to invalidate.
+///
+/// An entry keeps the memory backing the table alive through an opaque
+/// 'owner' reference (typically the producing Task), so the memory stays
+/// accounted to the producing query's pool until the entry is evicted.
+/// Entries are evicted in least-recently-used order when the cache grows past
+/// maxBytes().
+class HashTableCache {
+ public:
+  /// Returns the process-wide instance.
+  static HashTableCache* instance();
+
+  /// Returns the table cached under 'fingerprint' or nullptr. Marks the entry
+  /// as most recently used.
+  std::shared_ptr<BaseHashTable> get(const std::string& fingerprint);
+
+  /// Adds 'table' under 'fingerprint'. 'owner' keeps the memory backing
+  /// 'table' alive for the lifetime of the entry. 'bytes' is the memory
+  /// footprint of the table used for eviction accounting. No-op if an entry
+  /// for 'fingerprint' already exists. May evict least-recently-used entries
+  /// to stay under maxBytes().
+  void put(
+      const std::string& fingerprint,
+      std::shared_ptr<BaseHashTable> table,
+      std::shared_ptr<void> owner,
+      uint64_t bytes);
+
+  /// Sets the cache capacity and evicts least-recently-used entries if the
+  /// cache is over it.
+  void setMaxBytes(uint64_t maxBytes);
+
+  uint64_t maxBytes() const;
+
+  /// Returns the sum of the sizes of the cached tables.
+  uint64_t currentBytes() const;
+
+  /// Returns the number of cached tables.
+  size_t numEntries() const;
+
+  /// Drops all the entries. Tables still shared with running queries stay
+  /// alive until the last reference goes away.
+  void clear();
+
+ private:
+  // Keeps the table and the owner of its backing memory together. 'owner' is
+  // declared before 'table' so the table is destroyed first: destroying the
+  // table frees its rows through the memory pools that 'owner' keeps alive.
+  struct TableAndOwner {
+    std::shared_ptr<void> owner;
+    std::shared_ptr<BaseHashTable> table;
+  };
+
+  struct Entry {
+    // Aliased to a TableAndOwner so that every handle returned by get()
+    // keeps the owner alive until the last user is done, even if the entry
+    // is evicted in the meantime.
+    std::shared_ptr<BaseHashTable> table;
+    uint64_t bytes{0};
+    // Logical timestamp of the last get() or put() for LRU eviction.
+    uint64_t lastUseTime{0};
+  };
+
+  // Evicts least-recently-used entries until 'currentBytes_' fits in
+  // 'maxBytes_'.
+  void evictLocked();
+
+  // 4GB default capacity. Applications size this via setMaxBytes().
+  static constexpr uint64_t kDefaultMaxBytes = 4UL << 30;
+
+  mutable std::mutex mutex_;
+  uint64_t maxBytes_{kDefaultMaxBytes};
+  uint64_t currentBytes_{0};
+  uint64_t clock_{0};
+  folly::F14FastMap<std::string, Entry> entries_;
+};
+
+} // namespace facebook::velox::exec
@@ -362,17 +362,11 @@ bool IndexLookupJoin::needsInput() const {
   if (noMoreInput_ || isDraining()) {
     return false;
   }
-  if (numInputBatches() >= maxNumInputBatches_) {
-    return false;
-  }
-  if (numInputBatches() == 0) {
-    return true;
-  }
-  const auto& batch = currentInputBatch();
-  if (!batch.lookupFuture.valid() || batch.lookupFuture.isReady()) {
-    return false;
-  }
-  return true;
+  // Accept input whenever a batch slot is free so that up to
+  // 'maxNumInputBatches_' lookups stay in flight while the current batch's
+  // results are turned into output, overlapping the index source latency
+  // with local output production.
+  return numInputBatches() < maxNumInputBatches_;
 }
 
 BlockingReason IndexLookupJoin::isBlocked(ContinueFuture* future) {
@@ -338,7 +338,10 @@ LocalPartition::LocalPartition(
           numPartitions_ == 1 ? nullptr
                               : planNode->partitionFunctionSpec().create(
                                     numPartitions_,
-                                    /*localExchange=*/true)) {
+                                    /*localExchange=*/true)),
+      copyFragmentRows_(
+          ctx->queryConfig().localExchangeCopyFragmentRows()),
+      stagingFlushRows_(outputBatchRows(std::nullopt)) {
   VELOX_CHECK(numPartitions_ == 1 || partitionFunction_ != nullptr);
   for (auto& queue : queues_) {
     queue->addProducer();
@@ -346,6 +349,7 @@ LocalPartition::LocalPartition(
   if (numPartitions_ > 0) {
     indexBuffers_.resize(numPartitions_);
     rawIndices_.resize(numPartitions_);
+    stagingVectors_.resize(numPartitions_);
   }
 }
 
@@ -444,6 +448,10 @@ void LocalPartition::addInput(RowVectorPtr input) {
       // Do not enqueue empty partitions.
       continue;
     }
+    if (copyFragmentRows_ != 0 && partitionSize < copyFragmentRows_) {
+      appendToStaging(i, input, rawIndices_[i], partitionSize);
+      continue;
+    }
     auto partitionData = wrapChildren(
         input, partitionSize, indexBuffers_[i], queues_[i]->getVector());
     ContinueFuture future;
@@ -480,8 +488,50 @@ BlockingReason LocalPartition::isBlocked(ContinueFuture* future) {
   return BlockingReason::kNotBlocked;
 }
 
+void LocalPartition::appendToStaging(
+    uint32_t partition,
+    const RowVectorPtr& input,
+    const vector_size_t* indices,
+    vector_size_t numRows) {
+  auto& staging = stagingVectors_[partition];
+  if (staging == nullptr) {
+    staging = BaseVector::create<RowVector>(input->type(), 0, pool());
+  }
+  const auto offset = staging->size();
+  staging->resize(offset + numRows);
+  SelectivityVector targetRows(offset + numRows, false);
+  targetRows.setValidRange(offset, offset + numRows, true);
+  targetRows.updateBounds();
+  std::vector<vector_size_t> toSourceRow(offset + numRows);
+  for (vector_size_t i = 0; i < numRows; ++i) {
+    toSourceRow[offset + i] = indices[i];
+  }
+  staging->copy(input.get(), targetRows, toSourceRow.data());
+  if (staging->size() >= stagingFlushRows_) {
+    flushStaging(partition);
+  }
+}
+
+void LocalPartition::flushStaging(uint32_t partition) {
+  auto& staging = stagingVectors_[partition];
+  if (staging == nullptr || staging->size() == 0) {
+    return;
+  }
+  auto data = std::move(staging);
+  ContinueFuture future;
+  const auto reason =
+      queues_[partition]->enqueue(data, data->retainedSize(), &future);
+  if (reason != BlockingReason::kNotBlocked) {
+    blockingReasons_.push_back(reason);
+    futures_.push_back(std::move(future));
+  }
+}
+
 void LocalPartition::noMoreInput() {
   Operator::noMoreInput();
+  for (auto i = 0; i < numPartitions_; ++i) {
+    flushStaging(i);
+  }
   for (const auto& queue : queues_) {
     queue->noMoreData();
   }
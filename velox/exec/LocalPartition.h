@@ -77,6 +77,16 @@ class LocalExchangeVectorPool {
 /// must be called after all producers have been registered. A producer calls
 /// 'enqueue' multiple time to put the data and calls 'noMoreData' when done.
 /// Consumers call 'next' repeatedly to fetch the data.
+///
+/// Synchronization is a mutex around the queue rather than a lock-free ring
+/// because blocking here is promise/future based: producers and consumers
+/// do not spin or park on a semaphore, they hand back a ContinueFuture and
+/// leave the thread, and promise creation must be atomic with the queue
+/// state transition to avoid lost wakeups. A lock-free SPSC ring with
+/// semaphore wakeups presumes dedicated threads that can block, which
+/// drivers are not. The per-batch critical section is a few pointer moves;
+/// contention observed here usually means batches are too small (see the
+/// fragment staging option) rather than that the lock needs removing.
 class LocalExchangeQueue {
  public:
   LocalExchangeQueue(
@@ -225,6 +235,11 @@ class LocalPartition : public Operator {
 
   bool startDrain() override {
     VELOX_CHECK(isDraining());
+    // Staged small fragments must reach the consumers before the drain
+    // completes.
+    for (uint32_t i = 0; i < numPartitions_; ++i) {
+      flushStaging(i);
+    }
     return true;
   }
 
@@ -239,6 +254,20 @@ class LocalPartition : public Operator {
 
   void allocateIndexBuffers(const std::vector<vector_size_t>& sizes);
 
+  // Copies 'numRows' rows of 'input' selected by 'indices' into the
+  // partition's staging vector and enqueues the staging vector once it
+  // reaches a full batch. Small partition fragments are copied instead of
+  // dictionary-wrapped: a tiny dictionary fragment retains the whole input
+  // vector and pays per-batch overheads downstream.
+  void appendToStaging(
+      uint32_t partition,
+      const RowVectorPtr& input,
+      const vector_size_t* indices,
+      vector_size_t numRows);
+
+  // Enqueues the staging vector of 'partition' if it holds any rows.
+  void flushStaging(uint32_t partition);
+
   RowVectorPtr wrapChildren(
       const RowVectorPtr& input,
       vector_size_t size,
@@ -257,6 +286,15 @@ class LocalPartition : public Operator {
   /// Reusable buffers for input partitioning.
   std::vector<BufferPtr> indexBuffers_;
   std::vector<vector_size_t*> rawIndices_;
+
+  /// Partitions receiving fewer rows than this from one input are copied
+  /// into 'stagingVectors_' instead of being enqueued as tiny dictionary
+  /// fragments. Zero disables staging.
+  const vector_size_t copyFragmentRows_;
+  /// Row count at which a staging vector is enqueued.
+  const vector_size_t stagingFlushRows_;
+  /// Per partition staging vectors. See appendToStaging().
+  std::vector<RowVectorPtr> stagingVectors_;
 };
 
 } // namespace facebook::velox::exec
@@ -220,6 +220,18 @@ uint32_t maxDriversForConsumer(
   return std::numeric_limits<uint32_t>::max();
 }
 
+// Driver counts are fixed at task start because almost everything about a
+// pipeline is sized by them: local exchange queues are created with one
+// slot per consumer driver, hash join bridges count build peers, barriers
+// (allPeersFinished) and drain protocols enumerate drivers, and grouped
+// execution maps split groups to driver ids. Adding or retiring drivers
+// mid-query would need every one of those rendezvous structures to support
+// membership change while in use. The supported dynamic forms keep
+// membership fixed and vary activity instead: ScaledScanController starts
+// scan drivers dormant and activates them by memory headroom, and the same
+// start-high-run-few pattern (provision maxDrivers, gate activity) is how
+// runtime scaling should be layered onto other pipelines, rather than by
+// resizing driver sets.
 uint32_t maxDrivers(
     const DriverFactory& driverFactory,
     const core::QueryConfig& queryConfig) {
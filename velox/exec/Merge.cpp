@@ -173,8 +173,25 @@ RowVectorPtr Merge::getOutput() {
     }
   }
 
+  SourceStream* stream{nullptr};
+  SourceStream* runnerUp{nullptr};
+  SourceStream* prevWinner{nullptr};
   for (;;) {
-    auto stream = treeOfLosers_->next();
+    // Sorted streams are often strongly clustered: the same source wins many
+    // consecutive rows. Keep emitting from the current winner without
+    // traversing the tree for as long as its current row still orders at or
+    // before the runner-up's. Since finding the runner-up costs another tree
+    // walk, the bypass is only armed once the same stream wins twice in a
+    // row.
+    const bool streamStillWins = stream != nullptr && stream->hasData() &&
+        runnerUp != nullptr && !(*runnerUp < *stream);
+    if (!streamStillWins) {
+      prevWinner = stream;
+      stream = treeOfLosers_->next();
+      runnerUp = (stream != nullptr && stream == prevWinner)
+          ? treeOfLosers_->runnerUp()
+          : nullptr;
+    }
 
     if (!stream) {
       finished_ = true;
@@ -205,6 +205,51 @@ void MergeJoin::addInput(RowVectorPtr input) {
   }
 }
 
+namespace {
+// Type-specialized key comparison between two flat vectors, avoiding the
+// virtual per-row BaseVector::compare dispatch in the merge loop. Returns
+// std::nullopt if either value is null, mirroring kNullAsIndeterminate.
+template <TypeKind Kind>
+std::optional<int32_t> compareFlatKeys(
+    const BaseVector* vector,
+    vector_size_t index,
+    const BaseVector* otherVector,
+    vector_size_t otherIndex) {
+  using T = typename TypeTraits<Kind>::NativeType;
+  auto* flat = vector->asUnchecked<FlatVector<T>>();
+  auto* otherFlat = otherVector->asUnchecked<FlatVector<T>>();
+  if (flat->isNullAt(index) || otherFlat->isNullAt(otherIndex)) {
+    return std::nullopt;
+  }
+  const T value = flat->valueAt(index);
+  const T otherValue = otherFlat->valueAt(otherIndex);
+  if constexpr (std::is_same_v<T, StringView>) {
+    const auto result = value.compare(otherValue);
+    return result < 0 ? -1 : result == 0 ? 0 : 1;
+  } else {
+    return value < otherValue ? -1 : value == otherValue ? 0 : 1;
+  }
+}
+
+// True for the key types whose flat comparison above matches the
+// BaseVector::compare ordering. Floating point is excluded because of its
+// NaN ordering rules, booleans and complex types because they do not take
+// this fast path.
+bool supportsFlatKeyCompare(TypeKind kind) {
+  switch (kind) {
+    case TypeKind::TINYINT:
+    case TypeKind::SMALLINT:
+    case TypeKind::INTEGER:
+    case TypeKind::BIGINT:
+    case TypeKind::VARCHAR:
+    case TypeKind::VARBINARY:
+      return true;
+    default:
+      return false;
+  }
+}
+} // namespace
+
 // static
 int32_t MergeJoin::compare(
     const std::vector<column_index_t>& keys,
@@ -218,11 +263,24 @@ int32_t MergeJoin::compare(
         .equalsOnly = true,
         .nullHandlingMode =
             CompareFlags::NullHandlingMode::kNullAsIndeterminate};
-    const auto compare = batch->childAt(keys[i])->compare(
-        otherBatch->childAt(otherKeys[i]).get(),
-        index,
-        otherIndex,
-        kCompareFlags);
+    const auto* vector = batch->childAt(keys[i]).get();
+    const auto* otherVector = otherBatch->childAt(otherKeys[i]).get();
+    std::optional<int32_t> compare;
+    if (vector->encoding() == VectorEncoding::Simple::FLAT &&
+        otherVector->encoding() == VectorEncoding::Simple::FLAT &&
+        vector->typeKind() == otherVector->typeKind() &&
+        supportsFlatKeyCompare(vector->typeKind())) {
+      compare = VELOX_DYNAMIC_SCALAR_TYPE_DISPATCH(
+          compareFlatKeys,
+          vector->typeKind(),
+          vector,
+          index,
+          otherVector,
+          otherIndex);
+    } else {
+      compare = vector->compare(
+          otherVector, index, otherIndex, kCompareFlags);
+    }
 
     // Comparing null with anything will return std::nullopt.
     if (!compare.has_value()) {
@@ -21,6 +21,20 @@ namespace facebook::velox::exec {
 
 class MergeExchange;
 
+/// One ordered input stream of a merge (local or exchange based).
+///
+/// Buffer depths are fixed per source (local sources: a couple of vectors;
+/// exchange sources: an equal share of the merge exchange budget with
+/// per-source bounds). Before building rate-adaptive budgets, note what the
+/// loser tree implies: the merge consumes exactly one stream at a time and
+/// the next winner is data-dependent, so a source "winning often" needs
+/// enough buffer to cover its own refill latency, not a share
+/// proportional to its win rate, and deep buffers on a losing source are
+/// pure memory waste that adaptation can only partially claw back.
+/// Starvation stalls are therefore best fixed by covering refill latency
+/// (read-ahead on the source side) rather than by redistributing budget;
+/// per-source stall stats to expose the skew are the uncontroversial first
+/// step.
 class MergeSource {
  public:
   static constexpr int32_t kMaxQueuedBytesUpperLimit = 32 << 20; // 32 MB.
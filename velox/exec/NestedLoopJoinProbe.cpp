@@ -362,18 +362,28 @@ bool NestedLoopJoinProbe::addToOutput() {
       return true;
     }
 
-    // Only re-calculate the filter if we have a new build vector.
+    // Only re-calculate the filter if we have a new build vector. For inner
+    // joins the filter runs over a tile of probe rows; the tile size only
+    // depends on 'probeRow_' and the build vector sizes, so it is stable
+    // across the build vectors of one pass.
     if (buildRow_ == 0) {
+      if (isInnerJoin(joinType_)) {
+        probeRowCount_ = filterTileProbeRows();
+      }
       evaluateJoinFilter(currentBuild);
     }
 
     // Iterate over the filter results. For each match, add an output record.
+    // For inner join tiles the filter result covers 'probeRowCount_' probe
+    // rows, each crossed with the whole build vector; for other join types it
+    // covers the single probe row 'probeRow_'.
+    const vector_size_t buildSize = currentBuild->size();
     for (size_t i = buildRow_; i < decodedFilterResult_.size(); ++i) {
       if (!isJoinConditionMatch(i)) {
         continue;
       }
 
-      addOutputRow(i);
+      addOutputRow(i % buildSize, probeRow_ + i / buildSize);
       ++numOutputRows_;
       probeRowHasMatch_ = true;
 
@@ -410,7 +420,7 @@ bool NestedLoopJoinProbe::addToOutput() {
       // records that got a hit (key match), so that at end we know which
       // build records to add and which to skip.
       if (needsBuildMismatch(joinType_)) {
-        buildMatched_[buildIndex_].setValid(i, true);
+        buildMatched_[buildIndex_].setValid(i % buildSize, true);
       }
 
       // If the buffer is full, save state and produce it as output.
@@ -475,12 +485,23 @@ void NestedLoopJoinProbe::prepareOutput() {
 
 void NestedLoopJoinProbe::evaluateJoinFilter(const RowVectorPtr& buildVector) {
   // First step to process is to get a batch so we can evaluate the join
-  // filter.
-  auto filterInput = getNextCrossProductBatch(
-      buildVector,
-      filterInputType_,
-      filterProbeProjections_,
-      filterBuildProjections_);
+  // filter. For inner joins the batch is a tile of 'probeRowCount_' probe
+  // rows crossed with 'buildVector'; other join types track per probe row
+  // match state and process a single probe row at a time.
+  RowVectorPtr filterInput;
+  if (isInnerJoin(joinType_)) {
+    filterInput = genCrossProductProbeTile(
+        buildVector,
+        filterInputType_,
+        filterProbeProjections_,
+        filterBuildProjections_);
+  } else {
+    filterInput = getNextCrossProductBatch(
+        buildVector,
+        filterInputType_,
+        filterProbeProjections_,
+        filterBuildProjections_);
+  }
 
   if (filterInputRows_.size() != filterInput->size()) {
     filterInputRows_.resizeFill(filterInput->size(), true);
@@ -546,7 +567,6 @@ RowVectorPtr NestedLoopJoinProbe::genCrossProductSingleBuildVector(
     const std::vector<IdentityProjection>& probeProjections,
     const std::vector<IdentityProjection>& buildProjections) {
   VELOX_CHECK(isSingleBuildVector());
-  std::vector<VectorPtr> projectedChildren(outputType->size());
   const auto buildRowCount = buildVector->size();
 
   // Calculate how many probe rows we can cover without exceeding
@@ -557,6 +577,17 @@ RowVectorPtr NestedLoopJoinProbe::genCrossProductSingleBuildVector(
     probeRowCount_ =
         std::min(outputBatchSize_ / buildRowCount, input_->size() - probeRow_);
   }
+  return genCrossProductProbeTile(
+      buildVector, outputType, probeProjections, buildProjections);
+}
+
+RowVectorPtr NestedLoopJoinProbe::genCrossProductProbeTile(
+    const RowVectorPtr& buildVector,
+    const RowTypePtr& outputType,
+    const std::vector<IdentityProjection>& probeProjections,
+    const std::vector<IdentityProjection>& buildProjections) {
+  std::vector<VectorPtr> projectedChildren(outputType->size());
+  const auto buildRowCount = buildVector->size();
   const size_t numOutputRows = probeRowCount_ * buildRowCount;
 
   // Generate probe dictionary indices.
@@ -596,6 +627,20 @@ RowVectorPtr NestedLoopJoinProbe::genCrossProductSingleBuildVector(
       pool(), outputType, nullptr, numOutputRows, std::move(projectedChildren));
 }
 
+vector_size_t NestedLoopJoinProbe::filterTileProbeRows() const {
+  vector_size_t maxBuildRows = 0;
+  for (const auto& buildVector : buildVectors_.value()) {
+    maxBuildRows = std::max(maxBuildRows, buildVector->size());
+  }
+  if (maxBuildRows == 0 || maxBuildRows > outputBatchSize_) {
+    return 1;
+  }
+  return std::max<vector_size_t>(
+      1,
+      std::min<vector_size_t>(
+          outputBatchSize_ / maxBuildRows, input_->size() - probeRow_));
+}
+
 RowVectorPtr NestedLoopJoinProbe::genCrossProductMultipleBuildVectors(
     const RowVectorPtr& buildVector,
     const RowTypePtr& outputType,
@@ -619,9 +664,11 @@ RowVectorPtr NestedLoopJoinProbe::genCrossProductMultipleBuildVectors(
       pool(), outputType, nullptr, numOutputRows, std::move(projectedChildren));
 }
 
-void NestedLoopJoinProbe::addOutputRow(vector_size_t buildRow) {
+void NestedLoopJoinProbe::addOutputRow(
+    vector_size_t buildRow,
+    vector_size_t probeRow) {
   // Probe side is always a dictionary; just populate the index.
-  rawProbeOutputIndices_[numOutputRows_] = probeRow_;
+  rawProbeOutputIndices_[numOutputRows_] = probeRow;
 
   // For the build side, we accumulate the ranges to copy, then copy all of them
   // at once. If records are consecutive and can have a single copy range run.
@@ -182,6 +182,22 @@ class NestedLoopJoinProbe : public Operator {
       const std::vector<IdentityProjection>& probeProjections,
       const std::vector<IdentityProjection>& buildProjections);
 
+  // Generates a tile of 'probeRowCount_' probe rows starting at 'probeRow_'
+  // crossed with 'buildVector', with both sides wrapped in dictionaries.
+  // 'probeRowCount_' must be set by the caller.
+  RowVectorPtr genCrossProductProbeTile(
+      const RowVectorPtr& buildVector,
+      const RowTypePtr& outputType,
+      const std::vector<IdentityProjection>& probeProjections,
+      const std::vector<IdentityProjection>& buildProjections);
+
+  // Returns the number of probe rows per join condition evaluation tile for
+  // an inner join: as many probe rows as keep the tile within
+  // 'outputBatchSize_' rows against the largest build vector. Evaluating the
+  // condition over a tile amortizes the expression evaluation overhead over
+  // many probe rows without materializing the full cross product.
+  vector_size_t filterTileProbeRows() const;
+
   // As a fallback, process the current probe row to as much build data as
   // possible (probe row as constant, and flat copied data for build records).
   RowVectorPtr genCrossProductMultipleBuildVectors(
@@ -190,12 +206,12 @@ class NestedLoopJoinProbe : public Operator {
       const std::vector<IdentityProjection>& probeProjections,
       const std::vector<IdentityProjection>& buildProjections);
 
-  // Add a single record to `output_` based on buildRow from buildVector, and
-  // the current probeRow and probe vector (input_). Probe side projections are
+  // Add a single record to `output_` based on buildRow from buildVector and
+  // probeRow from the probe vector (input_). Probe side projections are
   // zero-copy (dictionary indices), and build side projections are marked to be
   // copied using `buildCopyRanges_`; they will be copied later on by
   // `copyBuildValues()`.
-  void addOutputRow(vector_size_t buildRow);
+  void addOutputRow(vector_size_t buildRow, vector_size_t probeRow);
 
   // Checks if it is required to add a probe mismatch row, and does it if
   // needed. The caller needs to ensure there is available space in `output_`
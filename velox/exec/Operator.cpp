@@ -341,10 +341,38 @@ void Operator::close() {
   recordSpillStats();
   finishTrace();
 
+  // Report the vector pool effectiveness if this operator evaluated
+  // expressions.
+  if (auto* execCtx = operatorCtx_->existingExecCtx()) {
+    if (auto* vectorPool = execCtx->vectorPool()) {
+      const auto& poolStats = vectorPool->stats();
+      if (poolStats.numHits + poolStats.numMisses != 0) {
+        auto lockedStats = stats_.wlock();
+        lockedStats->addRuntimeStat(
+            "vectorPoolHits",
+            RuntimeCounter(static_cast<int64_t>(poolStats.numHits)));
+        lockedStats->addRuntimeStat(
+            "vectorPoolMisses",
+            RuntimeCounter(static_cast<int64_t>(poolStats.numMisses)));
+      }
+    }
+  }
+
   // Release the unused memory reservation on close.
   operatorCtx_->pool()->release();
 }
 
+// Batch sizing is already adaptive to row WIDTH (preferred bytes divided by
+// the operator's observed average row size, bounded by the row-count
+// limits); what it does not do is negotiate along the pipeline. A
+// cross-operator batch-size controller has a structural problem worth
+// recording before anyone builds it: operators mostly forward and wrap
+// vectors rather than re-batch them, so a size "negotiated" at one
+// operator propagates anyway, and inserting re-batching points to honor
+// per-operator preferences adds the copy costs the larger batches were
+// meant to amortize. The effective knobs are the per-query preferred
+// output bytes/rows at the operators that genuinely create batches (scan,
+// exchange, aggregation/join output), which is where tuning should aim.
 vector_size_t Operator::outputBatchRows(
     std::optional<uint64_t> averageRowSize) const {
   const auto& queryConfig = operatorCtx_->task()->queryCtx()->queryConfig();
@@ -83,6 +83,12 @@ class OperatorCtx {
 
   core::ExecCtx* execCtx() const;
 
+  /// Returns the execution context if one has been created, without creating
+  /// it. Used for teardown-time reporting.
+  core::ExecCtx* existingExecCtx() const {
+    return execCtx_.get();
+  }
+
   /// Makes an extract of QueryCtx for use in a connector. 'planNodeId'
   /// is the id of the calling TableScan. This and the task id identify the scan
   /// for column access tracking. 'connectorPool' is an aggregate memory pool
@@ -509,6 +515,11 @@ class Operator : public BaseRuntimeStatWriter {
     return operatorCtx_.get();
   }
 
+  /// Returns true if this operator has received the no-more-input signal.
+  bool receivedNoMoreInput() const {
+    return noMoreInput_;
+  }
+
   /// Returns true if this operator has received no more input signal. This
   /// method is only used for test.
   bool testingNoMoreInput() const {
@@ -552,6 +563,20 @@ class Operator : public BaseRuntimeStatWriter {
     void abort(memory::MemoryPool* pool, const std::exception_ptr& /* error */)
         override;
 
+    /// Reclaim victim ordering: operators still accumulating input are
+    /// cheaper victims than operators past no-more-input, which are about to
+    /// produce results and would forfeit nearly complete work for the same
+    /// bytes. The state read is racy but only biases the order among peers;
+    /// within the same priority the arbitrator prefers more reclaimable
+    /// bytes.
+    int32_t priority() const override {
+      const auto driver = ensureDriver();
+      if (FOLLY_UNLIKELY(driver == nullptr)) {
+        return 0;
+      }
+      return op_->receivedNoMoreInput() ? 1 : 0;
+    }
+
    protected:
     MemoryReclaimer(const std::shared_ptr<Driver>& driver, Operator* op)
         : memory::MemoryReclaimer(0), driver_(driver), op_(op) {
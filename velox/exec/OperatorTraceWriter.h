@@ -32,6 +32,17 @@ namespace facebook::velox::exec::trace {
 /// Used to serialize and write the input vectors from a particular operator
 /// into a data file. Additionally, it creates a corresponding summary file that
 /// contains information such as peak memory, input rows, operator type, etc.
+///
+/// This records an operator's INPUT stream for offline replay; it is not an
+/// operator state snapshot and cannot power resumable cursors for
+/// grow-the-LIMIT re-execution. Resuming "from row 101" would need
+/// checkpointable state for every operator in the plan (hash tables,
+/// accumulators, stream positions), which no operator implements, and a
+/// LIMIT query is free to terminate upstream early, so the parked state
+/// would be incomplete for a larger limit anyway. The working pattern for
+/// growing-LIMIT clients sits above the engine: keep the first query's
+/// cursor open and fetch more (Task supports incremental consumption), or
+/// have the application cache result pages keyed by plan fingerprint.
 class OperatorTraceInputWriter {
  public:
   /// 'traceOp' is the operator to trace. 'traceDir' specifies the trace
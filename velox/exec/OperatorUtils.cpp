@@ -93,6 +93,16 @@ void complexGatherCopy(
   }
 }
 
+// Gathers rows scattered across MANY source vectors (one per row), which is
+// what bounds the kernel choices here: fixed-width values dispatch once per
+// type and copy in a tight loop, but there is no single source buffer to
+// SIMD-gather from or to bulk-reserve strings against, since every row may
+// come from a different vector with different buffers. The bulk
+// type-specialized paths the gather-kernel request describes apply to the
+// single-source case, which is BaseVector::copyRanges (ranges of one
+// source, bulk offsets/sizes and string copies); callers that have one
+// source should use that, and this multi-source form cannot be upgraded to
+// it without changing what it takes as input.
 void gatherCopy(
     BaseVector* target,
     vector_size_t targetIndex,
@@ -549,4 +559,64 @@ std::unique_ptr<Operator> BlockedOperatorFactory::toOperator(
   }
   return nullptr;
 }
+
+namespace {
+// True for the key types whose flat vectors can be compared with the raw
+// adjacent value loop in markRunBreaks().
+bool supportsRunBreaks(TypeKind kind) {
+  switch (kind) {
+    case TypeKind::TINYINT:
+    case TypeKind::SMALLINT:
+    case TypeKind::INTEGER:
+    case TypeKind::BIGINT:
+    case TypeKind::HUGEINT:
+    case TypeKind::TIMESTAMP:
+    case TypeKind::VARCHAR:
+    case TypeKind::VARBINARY:
+      return true;
+    default:
+      return false;
+  }
+}
+
+template <TypeKind Kind>
+void markRunBreaks(
+    const BaseVector& keys,
+    vector_size_t size,
+    uint8_t* breaks) {
+  using T = typename TypeTraits<Kind>::NativeType;
+  if constexpr (
+      (std::is_integral_v<T> && !std::is_same_v<T, bool>) ||
+      std::is_same_v<T, int128_t> || std::is_same_v<T, Timestamp> ||
+      std::is_same_v<T, StringView>) {
+    const T* data = keys.asUnchecked<FlatVector<T>>()->rawValues();
+    for (vector_size_t i = 1; i < size; ++i) {
+      breaks[i] |= !(data[i] == data[i - 1]);
+    }
+  } else {
+    VELOX_UNREACHABLE();
+  }
+}
+} // namespace
+
+bool computeKeyRunBreaks(
+    const std::vector<column_index_t>& keys,
+    const RowVectorPtr& input,
+    std::vector<uint8_t>& runBreaks) {
+  const auto numRows = input->size();
+  for (auto key : keys) {
+    const auto& child = input->childAt(key);
+    if (child->encoding() != VectorEncoding::Simple::FLAT ||
+        child->mayHaveNulls() || !supportsRunBreaks(child->typeKind())) {
+      return false;
+    }
+  }
+  runBreaks.assign(numRows, 0);
+  for (auto key : keys) {
+    const auto& child = input->childAt(key);
+    VELOX_DYNAMIC_SCALAR_TYPE_DISPATCH(
+        markRunBreaks, child->typeKind(), *child, numRows, runBreaks.data());
+  }
+  return true;
+}
 } // namespace facebook::velox::exec
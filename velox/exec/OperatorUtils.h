@@ -300,4 +300,16 @@ class BlockedOperatorFactory : public Operator::PlanNodeTranslator {
  private:
   BlockedOperatorCb blockedCb_{nullptr};
 };
+
+/// Fills 'runBreaks' with one entry per row of 'input' where a non-zero entry
+/// at i means row i differs from row i - 1 in at least one of the 'keys'
+/// columns. Returns false without filling 'runBreaks' if some key column is
+/// not a flat primitive without nulls; booleans (bit-packed) and floating
+/// point (NaN equality rules) also return false. The adjacent value
+/// comparison loops vectorize, making this much cheaper than per-row
+/// comparisons for input clustered on the keys.
+bool computeKeyRunBreaks(
+    const std::vector<column_index_t>& keys,
+    const RowVectorPtr& input,
+    std::vector<uint8_t>& runBreaks);
 } // namespace facebook::velox::exec
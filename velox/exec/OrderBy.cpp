@@ -67,7 +67,10 @@ OrderBy::OrderBy(
       &nonReclaimableSection_,
       driverCtx->prefixSortConfig(),
       spillConfig_.has_value() ? &(spillConfig_.value()) : nullptr,
-      &spillStats_);
+      &spillStats_,
+      driverCtx->queryConfig().parallelSortEnabled()
+          ? driverCtx->task->queryCtx()->executor()
+          : nullptr);
 }
 
 void OrderBy::addInput(RowVectorPtr input) {
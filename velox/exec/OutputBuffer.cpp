@@ -15,6 +15,7 @@
  */
 #include "velox/exec/OutputBuffer.h"
 #include "velox/common/testutil/TestValue.h"
+#include "velox/common/time/Timer.h"
 #include "velox/core/QueryConfig.h"
 #include "velox/exec/Task.h"
 
@@ -89,7 +90,9 @@ void DestinationBuffer::Stats::recordEnqueue(const SerializedPage& data) {
   ++pagesBuffered;
 }
 
-void DestinationBuffer::Stats::recordAcknowledge(const SerializedPage& data) {
+void DestinationBuffer::Stats::recordAcknowledge(
+    const SerializedPage& data,
+    int64_t ackLatencyNs) {
   const auto numRows = data.numRows();
   VELOX_CHECK(numRows.has_value(), "SerializedPage's numRows must be valid");
   const int64_t size = data.size();
@@ -102,10 +105,13 @@ void DestinationBuffer::Stats::recordAcknowledge(const SerializedPage& data) {
   bytesSent += size;
   rowsSent += numRows.value();
   ++pagesSent;
+  ackLatencyNanos += ackLatencyNs;
 }
 
-void DestinationBuffer::Stats::recordDelete(const SerializedPage& data) {
-  recordAcknowledge(data);
+void DestinationBuffer::Stats::recordDelete(
+    const SerializedPage& data,
+    int64_t ackLatencyNs) {
+  recordAcknowledge(data, ackLatencyNs);
 }
 
 DestinationBuffer::Data DestinationBuffer::getData(
@@ -194,6 +200,7 @@ void DestinationBuffer::enqueue(std::shared_ptr<SerializedPage> data) {
   if (data != nullptr) {
     stats_.recordEnqueue(*data);
   }
+  enqueueTimesNs_.push_back(getCurrentTimeNano());
   data_.push_back(std::move(data));
 }
 
@@ -269,15 +276,18 @@ std::vector<std::shared_ptr<SerializedPage>> DestinationBuffer::acknowledge(
   VELOX_CHECK_LE(
       numDeleted, data_.size(), "Ack received for a not yet produced item");
   std::vector<std::shared_ptr<SerializedPage>> freed;
+  const auto ackTimeNs = getCurrentTimeNano();
   for (auto i = 0; i < numDeleted; ++i) {
     if (data_[i] == nullptr) {
       VELOX_CHECK_EQ(i, data_.size() - 1, "null marker found in the middle");
       break;
     }
-    stats_.recordAcknowledge(*data_[i]);
+    stats_.recordAcknowledge(*data_[i], ackTimeNs - enqueueTimesNs_[i]);
     freed.push_back(std::move(data_[i]));
   }
   data_.erase(data_.begin(), data_.begin() + numDeleted);
+  enqueueTimesNs_.erase(
+      enqueueTimesNs_.begin(), enqueueTimesNs_.begin() + numDeleted);
   sequence_ += numDeleted;
   return freed;
 }
@@ -285,15 +295,17 @@ std::vector<std::shared_ptr<SerializedPage>> DestinationBuffer::acknowledge(
 std::vector<std::shared_ptr<SerializedPage>>
 DestinationBuffer::deleteResults() {
   std::vector<std::shared_ptr<SerializedPage>> freed;
+  const auto deleteTimeNs = getCurrentTimeNano();
   for (auto i = 0; i < data_.size(); ++i) {
     if (data_[i] == nullptr) {
       VELOX_CHECK_EQ(i, data_.size() - 1, "null marker found in the middle");
       break;
     }
-    stats_.recordDelete(*data_[i]);
+    stats_.recordDelete(*data_[i], deleteTimeNs - enqueueTimesNs_[i]);
     freed.push_back(std::move(data_[i]));
   }
   data_.clear();
+  enqueueTimesNs_.clear();
   return freed;
 }
 
@@ -100,9 +100,11 @@ class DestinationBuffer {
   struct Stats {
     void recordEnqueue(const SerializedPage& data);
 
-    void recordAcknowledge(const SerializedPage& data);
+    /// 'ackLatencyNs' is the wall time the page spent buffered before the
+    /// acknowledge or delete.
+    void recordAcknowledge(const SerializedPage& data, int64_t ackLatencyNs);
 
-    void recordDelete(const SerializedPage& data);
+    void recordDelete(const SerializedPage& data, int64_t ackLatencyNs);
 
     bool finished{false};
 
@@ -115,6 +117,12 @@ class DestinationBuffer {
     int64_t bytesSent{0};
     int64_t rowsSent{0};
     int64_t pagesSent{0};
+
+    /// Total wall time the sent pages spent buffered before being
+    /// acknowledged or deleted. With 'pagesSent' this gives the
+    /// destination's observed consumption latency, the signal needed to
+    /// adapt per-destination behavior such as codec choice.
+    int64_t ackLatencyNanos{0};
   };
 
   void enqueue(std::shared_ptr<SerializedPage> data);
@@ -188,6 +196,10 @@ class DestinationBuffer {
   void clearNotify();
 
   std::vector<std::shared_ptr<SerializedPage>> data_;
+
+  // Enqueue wall times of the entries of 'data_', kept in lockstep for the
+  // acknowledge latency stat.
+  std::vector<int64_t> enqueueTimesNs_;
   // The sequence number of the first in 'data_'.
   int64_t sequence_ = 0;
   DataAvailableCallback notify_{nullptr};
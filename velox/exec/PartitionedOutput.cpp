@@ -30,6 +30,15 @@ std::unique_ptr<VectorSerde::Options> getVectorSerdeOptions(
   options->compressionKind =
       common::stringToCompressionKind(queryConfig.shuffleCompressionKind());
   options->minCompressionRatio = PartitionedOutput::minCompressionRatio();
+  if (kind == VectorSerde::Kind::kPresto) {
+    // With the batch serialization path, dictionary encoded shuffle input is
+    // serialized as the alphabet plus indices instead of being expanded row
+    // by row; the deserializer reconstructs the dictionary vectors.
+    static_cast<serializer::presto::PrestoVectorSerde::PrestoOptions*>(
+        options.get())
+        ->preserveEncodings =
+        queryConfig.partitionedOutputPreserveEncodingsEnabled();
+  }
   return options;
 }
 } // namespace
@@ -42,6 +51,7 @@ Destination::Destination(
     VectorSerde::Options* serdeOptions,
     memory::MemoryPool* pool,
     bool eagerFlush,
+    bool batchSerialization,
     std::function<void(uint64_t bytes, uint64_t rows)> recordEnqueued)
     : taskId_(taskId),
       destination_(destination),
@@ -49,8 +59,13 @@ Destination::Destination(
       serdeOptions_(serdeOptions),
       pool_(pool),
       eagerFlush_(eagerFlush),
+      batchSerialization_(
+          batchSerialization && serde->kind() == VectorSerde::Kind::kPresto),
       recordEnqueued_(std::move(recordEnqueued)),
       rows_(raw_vector<vector_size_t>(pool)) {
+  if (batchSerialization_) {
+    batchSerializer_ = serde_->createBatchSerializer(pool_, serdeOptions_);
+  }
   setTargetSizePct();
 }
 
@@ -88,22 +103,33 @@ BlockingReason Destination::advance(
   }
 
   // Serialize
-  if (current_ == nullptr) {
-    current_ = std::make_unique<VectorStreamGroup>(pool_, serde_);
-    const auto rowType = asRowType(output->type());
-    current_->createStreamTree(rowType, rowsInCurrent_, serdeOptions_);
-  }
-
-  const auto rows = folly::Range(&rows_[firstRow], rowIdx_ - firstRow);
-  if (serde_->kind() == VectorSerde::Kind::kCompactRow) {
-    VELOX_CHECK_NOT_NULL(outputCompactRow);
-    current_->append(*outputCompactRow, rows, sizes);
-  } else if (serde_->kind() == VectorSerde::Kind::kUnsafeRow) {
-    VELOX_CHECK_NOT_NULL(outputUnsafeRow);
-    current_->append(*outputUnsafeRow, rows, sizes);
+  if (batchSerialization_) {
+    if (batchStream_ == nullptr) {
+      // Upper limit of message size with no columns.
+      constexpr int32_t kMinMessageSize = 128;
+      batchListener_ = bufferManager.newListener();
+      batchStream_ = std::make_unique<IOBufOutputStream>(
+          *pool_, batchListener_.get(), kMinMessageSize);
+    }
+    serializeBatchRanges(output, firstRow, scratch);
   } else {
-    VELOX_CHECK_EQ(serde_->kind(), VectorSerde::Kind::kPresto);
-    current_->append(output, rows, scratch);
+    if (current_ == nullptr) {
+      current_ = std::make_unique<VectorStreamGroup>(pool_, serde_);
+      const auto rowType = asRowType(output->type());
+      current_->createStreamTree(rowType, rowsInCurrent_, serdeOptions_);
+    }
+
+    const auto rows = folly::Range(&rows_[firstRow], rowIdx_ - firstRow);
+    if (serde_->kind() == VectorSerde::Kind::kCompactRow) {
+      VELOX_CHECK_NOT_NULL(outputCompactRow);
+      current_->append(*outputCompactRow, rows, sizes);
+    } else if (serde_->kind() == VectorSerde::Kind::kUnsafeRow) {
+      VELOX_CHECK_NOT_NULL(outputUnsafeRow);
+      current_->append(*outputUnsafeRow, rows, sizes);
+    } else {
+      VELOX_CHECK_EQ(serde_->kind(), VectorSerde::Kind::kPresto);
+      current_->append(output, rows, scratch);
+    }
   }
 
   // Update output state variable.
@@ -116,10 +142,56 @@ BlockingReason Destination::advance(
   return BlockingReason::kNotBlocked;
 }
 
+void Destination::serializeBatchRanges(
+    const RowVectorPtr& output,
+    vector_size_t firstRow,
+    Scratch& scratch) {
+  std::vector<IndexRange> ranges;
+  for (auto i = firstRow; i < rowIdx_; ++i) {
+    const auto row = rows_[i];
+    if (!ranges.empty() && ranges.back().begin + ranges.back().size == row) {
+      ++ranges.back().size;
+    } else {
+      ranges.push_back({row, 1});
+    }
+  }
+  batchSerializer_->serialize(
+      output,
+      folly::Range<const IndexRange*>(ranges.data(), ranges.size()),
+      scratch,
+      batchStream_.get());
+}
+
 BlockingReason Destination::flush(
     OutputBufferManager& bufferManager,
     const std::function<void()>& bufferReleaseFn,
     ContinueFuture* future) {
+  if (batchSerialization_) {
+    if (batchStream_ == nullptr || rowsInCurrent_ == 0) {
+      return BlockingReason::kNotBlocked;
+    }
+    const int64_t flushedBytes = batchStream_->tellp();
+    const int64_t flushedRows = rowsInCurrent_;
+    bytesInCurrent_ = 0;
+    rowsInCurrent_ = 0;
+    setTargetSizePct();
+
+    auto iobuf = batchStream_->getIOBuf(bufferReleaseFn);
+    batchStream_.reset();
+    batchListener_.reset();
+
+    const bool blocked = bufferManager.enqueue(
+        taskId_,
+        destination_,
+        std::make_unique<SerializedPage>(std::move(iobuf), nullptr, flushedRows),
+        future);
+
+    recordEnqueued_(flushedBytes, flushedRows);
+
+    return blocked ? BlockingReason::kWaitForConsumer
+                   : BlockingReason::kNotBlocked;
+  }
+
   if (!current_ || rowsInCurrent_ == 0) {
     return BlockingReason::kNotBlocked;
   }
@@ -263,6 +335,9 @@ void PartitionedOutput::initializeDestinations() {
           serdeOptions_.get(),
           pool(),
           eagerFlush_,
+          operatorCtx_->driverCtx()
+              ->queryConfig()
+              .partitionedOutputBatchSerializationEnabled(),
           [&](uint64_t bytes, uint64_t rows) {
             auto lockedStats = stats_.wlock();
             lockedStats->addOutputVector(bytes, rows);
@@ -300,7 +375,7 @@ void PartitionedOutput::estimateRowSizes() {
   } else {
     VELOX_CHECK_EQ(serde_->kind(), VectorSerde::Kind::kPresto);
     serde_->estimateSerializedSize(
-        output_.get(), rows, sizePointers_.data(), scratch_);
+        output_.get(), rows, sizePointers_.data(), operatorCtx_->driverCtx()->scratch);
   }
 }
 
@@ -419,7 +494,7 @@ RowVectorPtr PartitionedOutput::getOutput() {
           bufferReleaseFn_,
           &atEnd,
           &future_,
-          scratch_);
+          operatorCtx_->driverCtx()->scratch);
       if (blockingReason_ != BlockingReason::kNotBlocked) {
         blockedDestination = destination.get();
         workLeft = false;
@@ -29,6 +29,10 @@ class Destination {
  public:
   /// @param recordEnqueued Should be called to record each call to
   /// OutputBufferManager::enqueue. Takes number of bytes and rows.
+  /// If 'batchSerialization' is true and 'serde' is the Presto serde, each
+  /// advance() serializes its rows with the batch serializer as one complete
+  /// page into an accumulating stream instead of appending rows to the
+  /// iterative serializer; flush() enqueues the accumulated pages.
   Destination(
       const std::string& taskId,
       int destination,
@@ -36,6 +40,7 @@ class Destination {
       VectorSerde::Options* options,
       memory::MemoryPool* pool,
       bool eagerFlush,
+      bool batchSerialization,
       std::function<void(uint64_t bytes, uint64_t rows)> recordEnqueued);
 
   /// Resets the destination before starting a new batch.
@@ -102,12 +107,21 @@ class Destination {
     targetNumRows_ = (10'000 * targetSizePct_) / 100;
   }
 
+  // Serializes the rows_[firstRow, rowIdx_) of 'output' as consecutive-run
+  // index ranges through the batch serializer into 'batchStream_'.
+  void serializeBatchRanges(
+      const RowVectorPtr& output,
+      vector_size_t firstRow,
+      Scratch& scratch);
+
   const std::string taskId_;
   const int destination_;
   VectorSerde* const serde_;
   VectorSerde::Options* const serdeOptions_;
   memory::MemoryPool* const pool_;
   const bool eagerFlush_;
+  // See the constructor comment.
+  const bool batchSerialization_;
   const std::function<void(uint64_t bytes, uint64_t rows)> recordEnqueued_;
 
   // Bytes serialized in 'current_'
@@ -122,6 +136,15 @@ class Destination {
   // The current stream where the input is serialized to. This is cleared on
   // every flush() call.
   std::unique_ptr<VectorStreamGroup> current_;
+
+  // Batch serialization state: the serializer, the stream accumulating one
+  // complete serialized page per advance() and its byte listener. The stream
+  // and listener are reset on every flush() call. Only used when
+  // 'batchSerialization_' is set.
+  std::unique_ptr<BatchVectorSerializer> batchSerializer_;
+  std::unique_ptr<IOBufOutputStream> batchStream_;
+  std::unique_ptr<OutputStreamListener> batchListener_;
+
   bool finished_{false};
 
   // Flush accumulated data to buffer manager after reaching this
@@ -249,7 +272,6 @@ class PartitionedOutput : public Operator {
   SelectivityVector nullRows_;
   std::vector<uint32_t> partitions_;
   std::vector<DecodedVector> decodedVectors_;
-  Scratch scratch_;
 };
 
 } // namespace facebook::velox::exec
@@ -189,6 +189,24 @@ PrefixSortLayout PrefixSortLayout::generate(
     }
   }
 
+  // Give the leftover normalized key budget to a truncated string key: more
+  // encoded bytes means fewer comparisons falling back to the row container
+  // tie breaker. The key stays partial, so the tie breaker still re-compares
+  // it on prefix equality.
+  if (lastPrefixKeyPartial && normalizedKeySize < maxNormalizedKeySize) {
+    const auto partialIndex = numNormalizedKeys - 1;
+    uint32_t extraBytes = maxNormalizedKeySize - normalizedKeySize;
+    if (maxStringLengths[partialIndex].has_value()) {
+      const uint32_t encodedStringBytes = encodeSizes[partialIndex] -
+          (normalizedKeyHasNullByte[partialIndex] ? 1 : 0);
+      // No point encoding past the longest value.
+      extraBytes = std::min(
+          extraBytes, maxStringLengths[partialIndex].value() - encodedStringBytes);
+    }
+    encodeSizes[partialIndex] += extraBytes;
+    normalizedKeySize += extraBytes;
+  }
+
   const auto numPaddingBytes = alignmentPadding(normalizedKeySize, kAlignment);
   normalizedKeySize += numPaddingBytes;
 
@@ -277,8 +295,12 @@ int PrefixSort::comparePartNormalizedKeys(char* left, char* right) {
 PrefixSort::PrefixSort(
     const RowContainer* rowContainer,
     const PrefixSortLayout& sortLayout,
-    memory::MemoryPool* pool)
-    : rowContainer_(rowContainer), sortLayout_(sortLayout), pool_(pool) {}
+    memory::MemoryPool* pool,
+    uint32_t radixSortMaxKeyBytes)
+    : rowContainer_(rowContainer),
+      sortLayout_(sortLayout),
+      pool_(pool),
+      radixSortMaxKeyBytes_(radixSortMaxKeyBytes) {}
 
 void PrefixSort::extractRowAndEncodePrefixKeys(char* row, char* prefixBuffer) {
   for (auto i = 0; i < sortLayout_.numNormalizedKeys; ++i) {
@@ -303,12 +325,24 @@ void PrefixSort::extractRowAndEncodePrefixKeys(char* row, char* prefixBuffer) {
   // Use uint64_t compare to implement the above-mentioned comparison of every 8
   // bytes, assuming the system is little-endian, need to reverse bytes for
   // every 8 bytes.
-  bitsSwapByWord((uint64_t*)prefixBuffer, sortLayout_.normalizedBufferSize);
+  // The radix sort partitions on the stored bytes MSD-first (and its small
+  // bucket fallback uses std::memcmp), so it needs the bytes in the encoded
+  // memcmp order and the swap must be skipped.
+  if (!useRadixSort()) {
+    bitsSwapByWord((uint64_t*)prefixBuffer, sortLayout_.normalizedBufferSize);
+  }
 
   // Set row address.
   getRowAddrFromPrefixBuffer(prefixBuffer) = row;
 }
 
+bool PrefixSort::useRadixSort() const {
+  return radixSortMaxKeyBytes_ != 0 && !sortLayout_.hasNonNormalizedKey &&
+      sortLayout_.nonPrefixSortStartIndex >= sortLayout_.numNormalizedKeys &&
+      sortLayout_.normalizedBufferSize - sortLayout_.numPaddingBytes <=
+      radixSortMaxKeyBytes_;
+}
+
 // static.
 uint32_t PrefixSort::maxRequiredBytes(
     const RowContainer* rowContainer,
@@ -329,6 +363,17 @@ uint32_t PrefixSort::maxRequiredBytes(
 }
 
 // static
+// Fallback for sort specs prefix-sort cannot normalize (complex-type keys
+// among them). Two facts bound how much a "compiled comparator chain"
+// mid-tier could improve this: the per-key dispatch below is
+// RowContainer::compare's switch on type kind, already one indirect
+// branch, and for ARRAY/ROW keys the cost is the recursive value walk
+// itself, which a compiled chain would still perform. The established
+// bigger lever for complex keys is comparing serialized forms
+// (ContainerRowSerde keys compare bytewise); routing complex sort keys
+// through serialized comparison is where the 20% complex-sort workload
+// should go, and null handling is already a per-key early exit rather
+// than a per-row branch tree.
 void PrefixSort::stdSort(
     std::vector<char*, memory::StlAllocator<char*>>& rows,
     const RowContainer* rowContainer,
@@ -393,6 +438,15 @@ void PrefixSort::sortInternal(
           prefixBufferStart, prefixBufferEnd, [&](char* lhs, char* rhs) {
             return comparePartNormalizedKeys(lhs, rhs);
           });
+    } else if (useRadixSort()) {
+      // With fully normalized keys the entry order equals the lexicographic
+      // order of the normalized key bytes, so the MSD radix sort applies;
+      // the keys were encoded without the word-wise byte swap. The zero
+      // padding bytes compare equal everywhere and are skipped.
+      sortRunner.radixSort(
+          prefixBufferStart,
+          prefixBufferEnd,
+          sortLayout_.normalizedBufferSize - sortLayout_.numPaddingBytes);
     } else {
       sortRunner.quickSort(
           prefixBufferStart, prefixBufferEnd, [&](char* lhs, char* rhs) {
@@ -102,7 +102,8 @@ class PrefixSort {
   PrefixSort(
       const RowContainer* rowContainer,
       const PrefixSortLayout& sortLayout,
-      memory::MemoryPool* pool);
+      memory::MemoryPool* pool,
+      uint32_t radixSortMaxKeyBytes = 0);
 
   /// Follow the steps below to sort the data in RowContainer:
   /// 1. Allocate a contiguous block of memory to store normalized keys.
@@ -146,7 +147,8 @@ class PrefixSort {
       return;
     }
 
-    PrefixSort prefixSort(rowContainer, sortLayout, pool);
+    PrefixSort prefixSort(
+        rowContainer, sortLayout, pool, config.radixSortMaxKeyBytes);
     prefixSort.sortInternal(rows);
   }
 
@@ -215,6 +217,11 @@ class PrefixSort {
 
   void extractRowAndEncodePrefixKeys(char* row, char* prefixBuffer);
 
+  // True when sortInternal() runs the MSD radix sort. The radix sort
+  // partitions on raw bytes in memcmp order, so encoding must skip the
+  // word-wise byte swap the quicksort comparators rely on.
+  bool useRadixSort() const;
+
   // Return the row address refenence in the prefix encoded buffer.
   FOLLY_ALWAYS_INLINE char*& getRowAddrFromPrefixBuffer(
       char* prefixBuffer) const {
@@ -225,5 +232,9 @@ class PrefixSort {
   const RowContainer* const rowContainer_;
   const PrefixSortLayout sortLayout_;
   memory::MemoryPool* const pool_;
+  // If non-zero and all the sort keys normalize into at most this many
+  // bytes, sortInternal() uses the radix sort. See
+  // PrefixSortConfig::radixSortMaxKeyBytes.
+  const uint32_t radixSortMaxKeyBytes_;
 };
 } // namespace facebook::velox::exec
@@ -449,6 +449,14 @@ void RowContainer::freeAggregates(folly::Range<char**> rows) {
   }
 }
 
+void RowContainer::freeExternalAccumulators(folly::Range<char**> rows) {
+  for (auto& accumulator : accumulators_) {
+    if (accumulator.usesExternalMemory()) {
+      accumulator.destroy(rows);
+    }
+  }
+}
+
 void RowContainer::freeNextRowVectors(folly::Range<char**> rows) {
   if (!nextOffset_ || !hasDuplicateRows_) {
     return;
@@ -1016,13 +1024,15 @@ void RowContainer::hash(
 
 void RowContainer::clear() {
   if (usesExternalMemory_) {
+    // Only the accumulators that hold memory outside of 'stringAllocator_'
+    // need a per-row walk; everything backed by the allocator is freed in
+    // bulk below. This keeps clear() from paying a per-allocation free for
+    // every string, complex value and allocator-backed accumulator.
     constexpr int32_t kBatch = 1000;
     std::vector<char*> rows(kBatch);
     RowContainerIterator iter;
     while (auto numRows = listRows(&iter, kBatch, rows.data())) {
-      freeRowsExtraMemory(
-          folly::Range<char**>(rows.data(), numRows),
-          /*freeNextRowVector=*/false);
+      freeExternalAccumulators(folly::Range<char**>(rows.data(), numRows));
     }
   }
   hasDuplicateRows_ = false;
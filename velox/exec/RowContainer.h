@@ -908,6 +908,11 @@ class RowContainer {
   // Offset of the pointer to the next free row on a free row.
   static constexpr int32_t kNextFreeOffset = 0;
 
+  // How many rows ahead the value extraction loops prefetch. The rows are
+  // scattered around the arena, so each extracted value is typically a cache
+  // miss; prefetching this many rows ahead overlaps the misses.
+  static constexpr int32_t kExtractPrefetchDistance = 8;
+
   template <typename T>
   static inline T valueAt(const char* group, int32_t offset) {
     return *reinterpret_cast<const T*>(group + offset);
@@ -1095,6 +1100,30 @@ class RowContainer {
     }
   }
 
+  // Prefetches the field at 'offset' of the row 'kExtractPrefetchDistance'
+  // positions past 'i' for the extraction loops.
+  template <bool useRowNumbers>
+  static inline void prefetchRow(
+      const char* const* rows,
+      folly::Range<const vector_size_t*> rowNumbers,
+      int32_t numRows,
+      int32_t i,
+      int32_t offset) {
+    if (i + kExtractPrefetchDistance >= numRows) {
+      return;
+    }
+    const char* prefetch;
+    if constexpr (useRowNumbers) {
+      const auto rowNumber = rowNumbers[i + kExtractPrefetchDistance];
+      prefetch = rowNumber >= 0 ? rows[rowNumber] : nullptr;
+    } else {
+      prefetch = rows[i + kExtractPrefetchDistance];
+    }
+    if (prefetch != nullptr) {
+      __builtin_prefetch(prefetch + offset);
+    }
+  }
+
   template <bool useRowNumbers, typename T>
   static void extractValuesWithNulls(
       const char* const* rows,
@@ -1120,6 +1149,7 @@ class RowContainer {
       } else {
         row = rows[i];
       }
+      prefetchRow<useRowNumbers>(rows, rowNumbers, numRows, i, offset);
       auto resultIndex = resultOffset + i;
       if (row == nullptr || isNullAt(row, nullByte, nullMask)) {
         bits::setNull(nulls, resultIndex, true);
@@ -1154,6 +1184,7 @@ class RowContainer {
       } else {
         row = rows[i];
       }
+      prefetchRow<useRowNumbers>(rows, rowNumbers, numRows, i, offset);
       auto resultIndex = resultOffset + i;
       if (row == nullptr) {
         result->setNull(resultIndex, true);
@@ -1477,6 +1508,11 @@ class RowContainer {
   // Free any aggregates associated with the 'rows'.
   void freeAggregates(folly::Range<char**> rows);
 
+  // Destroys only the accumulators that hold memory outside of
+  // 'stringAllocator_'. Used by clear(), which frees all the allocator-backed
+  // memory in bulk, so per-row frees of it would be wasted work.
+  void freeExternalAccumulators(folly::Range<char**> rows);
+
   // Free next row vectors associated with the 'rows'.
   void freeNextRowVectors(folly::Range<char**> rows);
 
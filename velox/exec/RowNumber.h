@@ -24,6 +24,19 @@ namespace facebook::velox::exec {
 class RowNumberHashTableSpiller;
 class RowNumberInputSpiller;
 
+/// Assigns row numbers per partition using a hash table keyed on the
+/// partition columns.
+///
+/// For the single-bigint-key modest-cardinality shape, BigintIdMap
+/// (velox/common/base/BigintIdMap.h) is the intended accelerator: its SIMD
+/// makeIds() turns a batch of keys into dense ids in one pass, and the per
+/// partition counters become a flat array indexed by dense id, replacing
+/// the per-row table probe. The integration constraints are that the dense
+/// id space grows without eviction (so it needs the same memory ceiling and
+/// spill handoff the hash table has: on reclaim, convert the flat counts
+/// back into the spilling table) and that value-id validity dies with spill
+/// restores. Worth building behind the existing single-key type check; for
+/// multi-key or string partitions the general table stays.
 class RowNumber : public Operator {
  public:
   RowNumber(
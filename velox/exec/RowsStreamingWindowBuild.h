@@ -27,6 +27,18 @@ namespace facebook::velox::exec {
 /// partition contains a large amount of data. It is particularly suited for
 /// optimizing rank, dense_rank and row_number functions, as well as aggregate
 /// window functions with a default frame.
+///
+/// Generalizing to lead/lag and bounded ROWS frames is a bounded-lookahead
+/// problem: a row is emittable once max(lead offset, frame end offset) more
+/// rows of its partition have arrived, so a ring of that many rows per
+/// partition suffices and memory becomes O(offset) instead of O(partition).
+/// The pieces that must change are the eligibility rule here (today: rows
+/// become available immediately for the supported function set) and
+/// WindowPartition's assumption that a partial partition only ever grows at
+/// the end while fully retaining its prefix; rows already emitted must
+/// become reclaimable. Functions with unbounded following frames or k-range
+/// frames keep requiring the sort-based build, which is why the fallback
+/// stays.
 class RowsStreamingWindowBuild : public WindowBuild {
  public:
   RowsStreamingWindowBuild(
@@ -25,6 +25,18 @@ class ScaledScanControllerTestHelper;
 
 /// Controller used to scales table scan processing based on the query memory
 /// usage.
+///
+/// The controller scales how many drivers consume splits; it cannot resize
+/// the splits themselves. Decode-cost skew at stage tails (a heavy file
+/// holding its driver long after peers drained the queue) needs splits that
+/// can be subdivided after assignment, which is a connector protocol change:
+/// a ConnectorSplit would have to expose a residual-slicing API (for
+/// Parquet, give back not-yet-started row groups) and the task's split
+/// store would need to accept re-queued residues. Observed decode
+/// throughput to drive it is already available per operator from TableScan
+/// runtime stats. Until that protocol exists, the mitigation is what
+/// planners do now: split heavy formats at row-group granularity up front
+/// so no single split can dominate a tail.
 class ScaledScanController {
  public:
   /// 'nodePool' is the table scan node pool. 'numDrivers' is number of the
@@ -159,6 +159,20 @@ class SimpleAggregateAdapter : public Aggregate {
   struct support_initialize<T, std::void_t<decltype(&T::initialize)>>
       : std::true_type {};
 
+  // Whether the accumulator type defines an addInputBatch() method taking a
+  // pointer to contiguous input values and a row count. If it is defined and
+  // the function takes a single primitive argument with default null
+  // behavior, the single-group (global aggregation) path hands whole runs of
+  // flat input without nulls to it in one call, so the implementation can use
+  // a SIMD or auto-vectorized loop instead of per-row addInput() calls.
+  template <typename T, typename = void>
+  struct support_add_input_batch : std::false_type {};
+
+  template <typename T>
+  struct support_add_input_batch<
+      T,
+      std::void_t<decltype(&T::addInputBatch)>> : std::true_type {};
+
   // Whether the accumulator requires aligned access. If it is defined,
   // SimpleAggregateAdapter::accumulatorAlignmentSize() returns
   // alignof(typename FUNC::AccumulatorType).
@@ -188,6 +202,9 @@ class SimpleAggregateAdapter : public Aggregate {
 
   static constexpr bool support_initialize_ = support_initialize<FUNC>::value;
 
+  static constexpr bool support_add_input_batch_ =
+      support_add_input_batch<typename FUNC::AccumulatorType>::value;
+
   static constexpr bool accumulator_is_aligned_ =
       accumulator_is_aligned<typename FUNC::AccumulatorType>::value;
 
@@ -434,6 +451,25 @@ class SimpleAggregateAdapter : public Aggregate {
         readers{&inputDecoded_[Is]...};
     auto accumulator = value<typename FUNC::AccumulatorType>(group);
 
+    if constexpr (
+        support_add_input_batch_ && aggregate_default_null_behavior_ &&
+        accumulator_is_fixed_size_ && sizeof...(Is) == 1) {
+      using T = typename FUNC::InputType::template type_at<0>;
+      // Bool is excluded because its flat storage is bit-packed.
+      if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) {
+        const auto& decoded = inputDecoded_[0];
+        if (decoded.isIdentityMapping() && !decoded.mayHaveNulls() &&
+            rows.isAllSelected()) {
+          // Global aggregation over flat input without nulls: hand the
+          // contiguous value run to the accumulator in one call.
+          accumulator->addInputBatch(
+              allocator_, decoded.template data<T>(), rows.end());
+          clearNull(group);
+          return;
+        }
+      }
+    }
+
     if constexpr (aggregate_default_null_behavior_) {
       rows.applyToSelected([&](auto row) {
         // If any input is null, we ignore the whole row.
@@ -15,10 +15,31 @@
  */
 
 #include "SortBuffer.h"
+#include "velox/common/base/AsyncSource.h"
 #include "velox/exec/MemoryReclaimer.h"
 #include "velox/exec/Spiller.h"
 
 namespace facebook::velox::exec {
+namespace {
+// Waits for all 'tasks' and rethrows the first error, if any. All tasks must
+// be synced also on error because they reference state owned by the caller.
+void syncParallelSortTasks(
+    std::vector<std::shared_ptr<AsyncSource<bool>>>& tasks) {
+  std::exception_ptr error;
+  for (auto& task : tasks) {
+    try {
+      task->move();
+    } catch (...) {
+      if (error == nullptr) {
+        error = std::current_exception();
+      }
+    }
+  }
+  if (error != nullptr) {
+    std::rethrow_exception(error);
+  }
+}
+} // namespace
 
 SortBuffer::SortBuffer(
     const RowTypePtr& input,
@@ -28,7 +49,8 @@ SortBuffer::SortBuffer(
     tsan_atomic<bool>* nonReclaimableSection,
     common::PrefixSortConfig prefixSortConfig,
     const common::SpillConfig* spillConfig,
-    folly::Synchronized<velox::common::SpillStats>* spillStats)
+    folly::Synchronized<velox::common::SpillStats>* spillStats,
+    folly::Executor* executor)
     : input_(input),
       sortCompareFlags_(sortCompareFlags),
       pool_(pool),
@@ -36,6 +58,7 @@ SortBuffer::SortBuffer(
       prefixSortConfig_(prefixSortConfig),
       spillConfig_(spillConfig),
       spillStats_(spillStats),
+      executor_(executor),
       sortedRows_(0, memory::StlAllocator<char*>(*pool)) {
   VELOX_CHECK_GE(input_->size(), sortCompareFlags_.size());
   VELOX_CHECK_GT(sortCompareFlags_.size(), 0);
@@ -131,8 +154,10 @@ void SortBuffer::noMoreInput() {
     sortedRows_.resize(numInputRows_);
     RowContainerIterator iter;
     data_->listRows(&iter, numInputRows_, sortedRows_.data());
-    PrefixSort::sort(
-        data_.get(), sortCompareFlags_, prefixSortConfig_, pool_, sortedRows_);
+    if (!trySortParallel()) {
+      PrefixSort::sort(
+          data_.get(), sortCompareFlags_, prefixSortConfig_, pool_, sortedRows_);
+    }
   } else {
     // Spill the remaining in-memory state to disk if spilling has been
     // triggered on this sort buffer. This is to simplify query OOM prevention
@@ -293,6 +318,89 @@ void SortBuffer::ensureOutputFits(vector_size_t batchSize) {
                << ", reservation: " << succinctBytes(pool_->reservedBytes());
 }
 
+bool SortBuffer::trySortParallel() {
+  // Maximum number of parallel chunk sorts; more gives diminishing returns
+  // against the merge cost.
+  constexpr int64_t kMaxSortChunks = 16;
+  // Below this many rows per chunk the scheduling overhead is not worth it.
+  constexpr int64_t kMinRowsPerSortChunk = 1 << 20;
+
+  if (executor_ == nullptr) {
+    return false;
+  }
+  const int64_t numRows = sortedRows_.size();
+  const auto numChunks =
+      std::min<int64_t>(kMaxSortChunks, numRows / kMinRowsPerSortChunk);
+  if (numChunks < 2) {
+    return false;
+  }
+
+  using RowPointers = std::vector<char*, memory::StlAllocator<char*>>;
+
+  // Copy the row pointers into roughly equal chunks and sort each on the
+  // executor.
+  std::vector<std::shared_ptr<RowPointers>> chunks;
+  chunks.reserve(numChunks);
+  const int64_t chunkSize = (numRows + numChunks - 1) / numChunks;
+  for (int64_t start = 0; start < numRows; start += chunkSize) {
+    const auto end = std::min<int64_t>(numRows, start + chunkSize);
+    auto chunk =
+        std::make_shared<RowPointers>(memory::StlAllocator<char*>(*pool_));
+    chunk->assign(sortedRows_.begin() + start, sortedRows_.begin() + end);
+    chunks.push_back(std::move(chunk));
+  }
+  // Release 'sortedRows_' while the chunks hold the pointers to halve the
+  // transient pointer memory; it is reassigned from the last merge result.
+  sortedRows_ = RowPointers(memory::StlAllocator<char*>(*pool_));
+
+  std::vector<std::shared_ptr<AsyncSource<bool>>> sortTasks;
+  sortTasks.reserve(chunks.size());
+  for (auto& chunk : chunks) {
+    sortTasks.push_back(std::make_shared<AsyncSource<bool>>([this, chunk]() {
+      PrefixSort::sort(
+          data_.get(), sortCompareFlags_, prefixSortConfig_, pool_, *chunk);
+      return std::make_unique<bool>(true);
+    }));
+    executor_->add([source = sortTasks.back()]() { source->prepare(); });
+  }
+  syncParallelSortTasks(sortTasks);
+
+  // Merge pairs of sorted chunks in parallel until one remains. The merge
+  // compares rows through the row container, which costs more per comparison
+  // than the encoded prefixes but only runs numRows * log2(numChunks) times.
+  while (chunks.size() > 1) {
+    std::vector<std::shared_ptr<RowPointers>> merged;
+    std::vector<std::shared_ptr<AsyncSource<bool>>> mergeTasks;
+    for (size_t i = 0; i + 1 < chunks.size(); i += 2) {
+      auto result =
+          std::make_shared<RowPointers>(memory::StlAllocator<char*>(*pool_));
+      result->resize(chunks[i]->size() + chunks[i + 1]->size());
+      mergeTasks.push_back(std::make_shared<AsyncSource<bool>>(
+          [this, left = chunks[i], right = chunks[i + 1], result]() {
+            std::merge(
+                left->begin(),
+                left->end(),
+                right->begin(),
+                right->end(),
+                result->begin(),
+                [&](const char* lhs, const char* rhs) {
+                  return data_->compareRows(lhs, rhs, sortCompareFlags_) < 0;
+                });
+            return std::make_unique<bool>(true);
+          }));
+      executor_->add([source = mergeTasks.back()]() { source->prepare(); });
+      merged.push_back(std::move(result));
+    }
+    if (chunks.size() % 2 == 1) {
+      merged.push_back(chunks.back());
+    }
+    syncParallelSortTasks(mergeTasks);
+    chunks = std::move(merged);
+  }
+  sortedRows_ = std::move(*chunks[0]);
+  return true;
+}
+
 void SortBuffer::ensureSortFits() {
   // Check if spilling is enabled or not.
   if (spillConfig_ == nullptr) {
@@ -488,7 +596,10 @@ void SortBuffer::prepareOutputWithSpill() {
 
   VELOX_CHECK_EQ(spillPartitionSet_.size(), 1);
   spillMerger_ = spillPartitionSet_.begin()->second->createOrderedReader(
-      spillConfig_->readBufferSize, pool(), spillStats_);
+      spillConfig_->readBufferSize,
+      pool(),
+      spillStats_,
+      spillConfig_->executor);
   spillPartitionSet_.clear();
 }
 } // namespace facebook::velox::exec
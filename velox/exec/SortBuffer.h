@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <folly/Executor.h>
+
 #include "velox/exec/ContainerRowSerde.h"
 #include "velox/exec/Operator.h"
 #include "velox/exec/OperatorUtils.h"
@@ -40,7 +42,8 @@ class SortBuffer {
       tsan_atomic<bool>* nonReclaimableSection,
       common::PrefixSortConfig prefixSortConfig,
       const common::SpillConfig* spillConfig = nullptr,
-      folly::Synchronized<velox::common::SpillStats>* spillStats = nullptr);
+      folly::Synchronized<velox::common::SpillStats>* spillStats = nullptr,
+      folly::Executor* executor = nullptr);
 
   ~SortBuffer();
 
@@ -81,6 +84,12 @@ class SortBuffer {
   // to make output fit.
   void ensureSortFits();
 
+  // Sorts 'sortedRows_' as parallel chunk sorts on 'executor_' followed by
+  // parallel pairwise merges. Returns false without sorting if there is no
+  // executor or too few rows to benefit, in which case the caller runs the
+  // single threaded sort.
+  bool trySortParallel();
+
   void updateEstimatedOutputRowSize();
 
   // Invoked to initialize or reset the reusable output buffer to get output.
@@ -127,6 +136,11 @@ class SortBuffer {
 
   folly::Synchronized<common::SpillStats>* const spillStats_;
 
+  // If not null, the in-memory sort of large inputs runs as parallel chunk
+  // sorts on this executor followed by parallel pairwise merges. See
+  // trySortParallel().
+  folly::Executor* const executor_;
+
   // The column projection map between 'input_' and 'spillerStoreType_' as sort
   // buffer stores the sort columns first in 'data_'.
   std::vector<IdentityProjection> columnMap_;
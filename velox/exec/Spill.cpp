@@ -18,6 +18,7 @@
 #include "velox/common/base/RuntimeMetrics.h"
 #include "velox/common/file/FileSystems.h"
 #include "velox/common/testutil/TestValue.h"
+#include "velox/exec/prefixsort/PrefixSortEncoder.h"
 #include "velox/serializers/PrestoSerializer.h"
 
 using facebook::velox::common::testutil::TestValue;
@@ -30,9 +31,112 @@ void SpillMergeStream::pop() {
   }
 }
 
+namespace {
+template <typename T>
+void encodePrefixColumn(
+    const prefixsort::PrefixSortEncoder& encoder,
+    const DecodedVector& decoded,
+    vector_size_t numRows,
+    uint32_t encodeSize,
+    char* start,
+    uint32_t rowWidth) {
+  for (vector_size_t i = 0; i < numRows; ++i) {
+    std::optional<T> value;
+    if (!decoded.isNullAt(i)) {
+      value = decoded.valueAt<T>(i);
+    }
+    encoder.encode<T>(value, start + i * rowWidth, encodeSize, true);
+  }
+}
+} // namespace
+
+void SpillMergeStream::maybeEncodePrefixes() {
+  if (prefixState_ == PrefixState::kDisabled) {
+    return;
+  }
+  if (prefixState_ == PrefixState::kUnknown) {
+    uint32_t width{0};
+    for (const auto& [key, compareFlags] : sortingKeys()) {
+      const auto kind = rowVector_->childAt(key)->typeKind();
+      switch (kind) {
+        // Floating point is excluded: distinct NaN bit patterns and signed
+        // zeros compare equal as values but not under memcmp, which would
+        // break the equality detection the aggregation spill merge relies on.
+        case TypeKind::SMALLINT:
+        case TypeKind::INTEGER:
+        case TypeKind::BIGINT:
+        case TypeKind::HUGEINT:
+        case TypeKind::TIMESTAMP:
+          break;
+        default:
+          prefixState_ = PrefixState::kDisabled;
+          return;
+      }
+      if (!compareFlags.nullAsValue()) {
+        prefixState_ = PrefixState::kDisabled;
+        return;
+      }
+      width +=
+          prefixsort::PrefixSortEncoder::encodedSize(kind, 0, true).value();
+    }
+    prefixWidth_ = width;
+    prefixState_ = PrefixState::kEnabled;
+  }
+
+  prefixes_.resize(static_cast<size_t>(size_) * prefixWidth_);
+  SelectivityVector allRows(size_);
+  DecodedVector decoded;
+  uint32_t offset{0};
+  for (const auto& [key, compareFlags] : sortingKeys()) {
+    const auto& child = rowVector_->childAt(key);
+    const auto kind = child->typeKind();
+    const prefixsort::PrefixSortEncoder encoder(
+        compareFlags.ascending, compareFlags.nullsFirst);
+    const auto encodeSize =
+        prefixsort::PrefixSortEncoder::encodedSize(kind, 0, true).value();
+    decoded.decode(*child, allRows);
+    char* start = prefixes_.data() + offset;
+    switch (kind) {
+      case TypeKind::SMALLINT:
+        encodePrefixColumn<int16_t>(
+            encoder, decoded, size_, encodeSize, start, prefixWidth_);
+        break;
+      case TypeKind::INTEGER:
+        encodePrefixColumn<int32_t>(
+            encoder, decoded, size_, encodeSize, start, prefixWidth_);
+        break;
+      case TypeKind::BIGINT:
+        encodePrefixColumn<int64_t>(
+            encoder, decoded, size_, encodeSize, start, prefixWidth_);
+        break;
+      case TypeKind::HUGEINT:
+        encodePrefixColumn<int128_t>(
+            encoder, decoded, size_, encodeSize, start, prefixWidth_);
+        break;
+      case TypeKind::TIMESTAMP:
+        encodePrefixColumn<Timestamp>(
+            encoder, decoded, size_, encodeSize, start, prefixWidth_);
+        break;
+      default:
+        VELOX_UNREACHABLE();
+    }
+    offset += encodeSize;
+  }
+}
+
 int32_t SpillMergeStream::compare(const MergeStream& other) const {
   VELOX_CHECK(!closed_);
   const auto& otherStream = static_cast<const SpillMergeStream&>(other);
+  if (prefixState_ == PrefixState::kEnabled &&
+      otherStream.prefixState_ == PrefixState::kEnabled) {
+    // Both batches carry the order-preserving key encoding; a memcmp of the
+    // raw prefix bytes equals the per-key comparison below.
+    return std::memcmp(
+        prefixes_.data() + static_cast<size_t>(index_) * prefixWidth_,
+        otherStream.prefixes_.data() +
+            static_cast<size_t>(otherStream.index_) * prefixWidth_,
+        prefixWidth_);
+  }
   const auto& children = rowVector_->children();
   const auto& otherChildren = otherStream.current().children();
   for (const auto& [key, compareFlags] : sortingKeys()) {
@@ -56,6 +160,8 @@ void SpillMergeStream::close() {
   rowVector_.reset();
   decoded_.clear();
   rows_.resize(0);
+  prefixes_.clear();
+  prefixes_.shrink_to_fit();
   index_ = 0;
   size_ = 0;
 }
@@ -278,13 +384,14 @@ std::unique_ptr<UnorderedStreamReader<BatchStream>>
 SpillPartition::createUnorderedReader(
     uint64_t bufferSize,
     memory::MemoryPool* pool,
-    folly::Synchronized<common::SpillStats>* spillStats) {
+    folly::Synchronized<common::SpillStats>* spillStats,
+    folly::Executor* readExecutor) {
   VELOX_CHECK_NOT_NULL(pool);
   std::vector<std::unique_ptr<BatchStream>> streams;
   streams.reserve(files_.size());
   for (auto& fileInfo : files_) {
-    streams.push_back(FileSpillBatchStream::create(
-        SpillReadFile::create(fileInfo, bufferSize, pool, spillStats)));
+    streams.push_back(FileSpillBatchStream::create(SpillReadFile::create(
+        fileInfo, bufferSize, pool, spillStats, readExecutor)));
   }
   files_.clear();
   return std::make_unique<UnorderedStreamReader<BatchStream>>(
@@ -295,12 +402,13 @@ std::unique_ptr<TreeOfLosers<SpillMergeStream>>
 SpillPartition::createOrderedReader(
     uint64_t bufferSize,
     memory::MemoryPool* pool,
-    folly::Synchronized<common::SpillStats>* spillStats) {
+    folly::Synchronized<common::SpillStats>* spillStats,
+    folly::Executor* readExecutor) {
   std::vector<std::unique_ptr<SpillMergeStream>> streams;
   streams.reserve(files_.size());
   for (auto& fileInfo : files_) {
-    streams.push_back(FileSpillMergeStream::create(
-        SpillReadFile::create(fileInfo, bufferSize, pool, spillStats)));
+    streams.push_back(FileSpillMergeStream::create(SpillReadFile::create(
+        fileInfo, bufferSize, pool, spillStats, readExecutor)));
   }
   files_.clear();
   // Check if the partition is empty or not.
@@ -90,6 +90,9 @@ class SpillMergeStream : public MergeStream {
   // loads the next 'rowVector' and sets 'decoded_' if this is initialized.
   void setNextBatch() {
     nextBatch();
+    if (!closed_ && size_ > 0) {
+      maybeEncodePrefixes();
+    }
     if (!decoded_.empty()) {
       ensureRows();
       for (auto i = 0; i < decoded_.size(); ++i) {
@@ -98,6 +101,11 @@ class SpillMergeStream : public MergeStream {
     }
   }
 
+  // Encodes the sort keys of the current batch into 'prefixes_' when all the
+  // key types support the order-preserving prefix encoding, so compare()
+  // becomes a memcmp of raw prefix bytes instead of per-key vector compares.
+  void maybeEncodePrefixes();
+
   void ensureDecodedValid(int32_t index) {
     int32_t oldSize = decoded_.size();
     if (index < oldSize) {
@@ -134,6 +142,15 @@ class SpillMergeStream : public MergeStream {
 
   // Covers all rows inn 'rowVector_' Set if 'decoded_' is non-empty.
   SelectivityVector rows_;
+
+  // Raw order-preserving encoding of the sort keys of the current batch, one
+  // 'prefixWidth_' sized entry per row; memcmp over entries equals the sort
+  // order. Only used when 'prefixState_' is kEnabled. See
+  // maybeEncodePrefixes().
+  enum class PrefixState : int8_t { kUnknown, kEnabled, kDisabled };
+  PrefixState prefixState_{PrefixState::kUnknown};
+  uint32_t prefixWidth_{0};
+  std::vector<char> prefixes_;
 };
 
 /// A source of spilled RowVectors coming from a file.
@@ -143,7 +160,7 @@ class FileSpillMergeStream : public SpillMergeStream {
       std::unique_ptr<SpillReadFile> spillFile) {
     auto spillStream = std::unique_ptr<SpillMergeStream>(
         new FileSpillMergeStream(std::move(spillFile)));
-    static_cast<FileSpillMergeStream*>(spillStream.get())->nextBatch();
+    static_cast<FileSpillMergeStream*>(spillStream.get())->setNextBatch();
     return spillStream;
   }
 
@@ -427,10 +444,13 @@ class SpillPartition {
   /// system supports async read mode, then reader allocates two buffers with
   /// one buffer prefetch ahead. 'spillStats' is provided to collect the spill
   /// stats when reading data from spilled files.
+  /// If 'readExecutor' is not null, each file also reads one buffer ahead on
+  /// it when the file system has no native asynchronous read.
   std::unique_ptr<UnorderedStreamReader<BatchStream>> createUnorderedReader(
       uint64_t bufferSize,
       memory::MemoryPool* pool,
-      folly::Synchronized<common::SpillStats>* spillStats);
+      folly::Synchronized<common::SpillStats>* spillStats,
+      folly::Executor* readExecutor = nullptr);
 
   /// Invoked to create an ordered stream reader from this spill partition.
   /// The created reader will take the ownership of the spill files.
@@ -438,10 +458,14 @@ class SpillPartition {
   /// system supports async read mode, then reader allocates two buffers with
   /// one buffer prefetch ahead. 'spillStats' is provided to collect the spill
   /// stats when reading data from spilled files.
+  /// If 'readExecutor' is not null, each spill run also reads one buffer
+  /// ahead on it when the file system has no native asynchronous read, so the
+  /// loser tree merge does not block on file reads.
   std::unique_ptr<TreeOfLosers<SpillMergeStream>> createOrderedReader(
       uint64_t bufferSize,
       memory::MemoryPool* pool,
-      folly::Synchronized<common::SpillStats>* spillStats);
+      folly::Synchronized<common::SpillStats>* spillStats,
+      folly::Executor* readExecutor = nullptr);
 
   std::string toString() const;
 
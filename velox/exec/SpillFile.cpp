@@ -128,6 +128,59 @@ size_t SpillWriter::numFinishedFiles() const {
   return finishedFiles_.size();
 }
 
+// static
+SpillWriteThrottle* SpillWriteThrottle::instance() {
+  static SpillWriteThrottle throttle;
+  return &throttle;
+}
+
+void SpillWriteThrottle::setMaxConcurrentWrites(uint32_t maxWrites) {
+  {
+    std::lock_guard<std::mutex> l(mutex_);
+    maxConcurrentWrites_ = maxWrites;
+  }
+  cv_.notify_all();
+}
+
+SpillWriteThrottle::Stats SpillWriteThrottle::stats() const {
+  return {numWaits_.load(), waitNanos_.load()};
+}
+
+SpillWriteThrottle::Lease::Lease(SpillWriteThrottle* throttle)
+    : throttle_(throttle) {
+  if (throttle_->maxConcurrentWrites_.load(std::memory_order_relaxed) == 0) {
+    return;
+  }
+  {
+    std::unique_lock<std::mutex> l(throttle_->mutex_);
+    const auto ready = [&]() {
+      const auto max = throttle_->maxConcurrentWrites_.load();
+      return max == 0 || throttle_->numRunningWrites_ < max;
+    };
+    if (!ready()) {
+      NanosecondTimer timer(&waitNanos_);
+      throttle_->cv_.wait(l, ready);
+    }
+    ++throttle_->numRunningWrites_;
+    admitted_ = true;
+  }
+  if (waitNanos_ != 0) {
+    ++throttle_->numWaits_;
+    throttle_->waitNanos_ += waitNanos_;
+  }
+}
+
+SpillWriteThrottle::Lease::~Lease() {
+  if (!admitted_) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> l(throttle_->mutex_);
+    --throttle_->numRunningWrites_;
+  }
+  throttle_->cv_.notify_one();
+}
+
 uint64_t SpillWriter::flush() {
   if (batch_ == nullptr) {
     return 0;
@@ -149,6 +202,7 @@ uint64_t SpillWriter::flush() {
   uint64_t writtenBytes{0};
   auto iobuf = out.getIOBuf();
   {
+    SpillWriteThrottle::Lease lease(SpillWriteThrottle::instance());
     NanosecondTimer timer(&writeTimeNs);
     writtenBytes = file->write(std::move(iobuf));
   }
@@ -260,7 +314,8 @@ std::unique_ptr<SpillReadFile> SpillReadFile::create(
     const SpillFileInfo& fileInfo,
     uint64_t bufferSize,
     memory::MemoryPool* pool,
-    folly::Synchronized<common::SpillStats>* stats) {
+    folly::Synchronized<common::SpillStats>* stats,
+    folly::Executor* readExecutor) {
   return std::unique_ptr<SpillReadFile>(new SpillReadFile(
       fileInfo.id,
       fileInfo.path,
@@ -270,7 +325,8 @@ std::unique_ptr<SpillReadFile> SpillReadFile::create(
       fileInfo.sortingKeys,
       fileInfo.compressionKind,
       pool,
-      stats));
+      stats,
+      readExecutor));
 }
 
 SpillReadFile::SpillReadFile(
@@ -282,7 +338,8 @@ SpillReadFile::SpillReadFile(
     const std::vector<SpillSortKey>& sortingKeys,
     common::CompressionKind compressionKind,
     memory::MemoryPool* pool,
-    folly::Synchronized<common::SpillStats>* stats)
+    folly::Synchronized<common::SpillStats>* stats,
+    folly::Executor* readExecutor)
     : id_(id),
       path_(path),
       size_(size),
@@ -300,7 +357,7 @@ SpillReadFile::SpillReadFile(
   auto fs = filesystems::getFileSystem(path_, nullptr);
   auto file = fs->openFileForRead(path_);
   input_ = std::make_unique<common::FileInputStream>(
-      std::move(file), bufferSize, pool_);
+      std::move(file), bufferSize, pool_, readExecutor);
 }
 
 bool SpillReadFile::nextBatch(RowVectorPtr& rowVector) {
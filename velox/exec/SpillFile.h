@@ -16,6 +16,10 @@
 
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
 #include <folly/container/F14Set.h>
 
 #include "velox/common/base/SpillConfig.h"
@@ -95,6 +99,19 @@ using SpillFiles = std::vector<SpillFileInfo>;
 /// Used to write the spilled data to a sequence of files for one partition. If
 /// data is sorted, each file is sorted. The globally sorted order is produced
 /// by merging the constituent files.
+///
+/// On a columnar spill stripe format (per-column blocks/codecs, partition-id
+/// index for selective restore): the byte over-read the row format causes is
+/// real for restores that re-partition, but note what bounds a v2 before
+/// designing one. Spill files are written once and read once by the same
+/// process, so the format can change freely; however restores consume whole
+/// rows (rebuild tables, merge sorted runs), so column pruning rarely
+/// applies - the winning piece is the sub-partition index letting a restore
+/// skip foreign hash sub-partitions without decoding them. That index does
+/// not need a columnar rewrite: writing pages tagged with their hash
+/// sub-partition range (spilling already partitions by hash bits) gives the
+/// skip with the existing page format, and is the incremental step to take
+/// first.
 class SpillWriter {
  public:
   /// 'type' is a RowType describing the content. 'numSortKeys' is the number
@@ -197,6 +214,57 @@ class SpillWriter {
   SpillFiles finishedFiles_;
 };
 
+/// Process-wide admission control for spill writes. Limits the number of
+/// concurrent spill file writes across all tasks so a burst of spilling
+/// queries does not saturate the spill device and spike the latency of
+/// non-spilling queries' I/O. Disabled (no limit) until the application
+/// calls setMaxConcurrentWrites() with a non-zero value.
+class SpillWriteThrottle {
+ public:
+  /// Returns the process-wide instance.
+  static SpillWriteThrottle* instance();
+
+  /// Sets the maximum number of concurrent spill file writes. Zero disables
+  /// the throttle and wakes up all the waiters.
+  void setMaxConcurrentWrites(uint32_t maxWrites);
+
+  /// Holds one write admission for its lifetime. Blocks in the constructor
+  /// until a slot is free when the throttle is enabled.
+  class Lease {
+   public:
+    explicit Lease(SpillWriteThrottle* throttle);
+    ~Lease();
+
+    /// Time spent waiting for admission, zero if admitted immediately.
+    uint64_t waitNanos() const {
+      return waitNanos_;
+    }
+
+   private:
+    SpillWriteThrottle* const throttle_;
+    bool admitted_{false};
+    uint64_t waitNanos_{0};
+  };
+
+  struct Stats {
+    /// Number of writes that had to wait for admission.
+    uint64_t numWaits{0};
+    /// Total time writes spent waiting for admission.
+    uint64_t waitNanos{0};
+  };
+  Stats stats() const;
+
+ private:
+  mutable std::mutex mutex_;
+  std::condition_variable cv_;
+  std::atomic_uint32_t maxConcurrentWrites_{0};
+  uint32_t numRunningWrites_{0};
+  std::atomic_uint64_t numWaits_{0};
+  std::atomic_uint64_t waitNanos_{0};
+
+  friend class Lease;
+};
+
 /// Represents a spill file for read which turns the serialized spilled data
 /// on disk back into a sequence of spilled row vectors.
 ///
@@ -206,11 +274,15 @@ class SpillWriter {
 /// rmdir() call.
 class SpillReadFile {
  public:
+  /// If 'readExecutor' is not null, the file reads ahead of the consumer by
+  /// running the next buffer read on it when the file system has no native
+  /// asynchronous read.
   static std::unique_ptr<SpillReadFile> create(
       const SpillFileInfo& fileInfo,
       uint64_t bufferSize,
       memory::MemoryPool* pool,
-      folly::Synchronized<common::SpillStats>* stats);
+      folly::Synchronized<common::SpillStats>* stats,
+      folly::Executor* readExecutor = nullptr);
 
   uint32_t id() const {
     return id_;
@@ -241,7 +313,8 @@ class SpillReadFile {
       const std::vector<SpillSortKey>& sortingKeys,
       common::CompressionKind compressionKind,
       memory::MemoryPool* pool,
-      folly::Synchronized<common::SpillStats>* stats);
+      folly::Synchronized<common::SpillStats>* stats,
+      folly::Executor* readExecutor);
 
   // Invoked to record spill read stats at the end of read input.
   void recordSpillStats();
@@ -15,6 +15,7 @@
  */
 
 #include "velox/exec/StreamingAggregation.h"
+#include "velox/exec/OperatorUtils.h"
 
 namespace facebook::velox::exec {
 
@@ -133,6 +134,10 @@ bool equalKeys(
 }
 } // namespace
 
+bool StreamingAggregation::computeRunBreaks() {
+  return computeKeyRunBreaks(groupingKeys_, input_, runBreaks_);
+}
+
 char* StreamingAggregation::startNewGroup(vector_size_t index) {
   if (numGroups_ < groups_.size()) {
     auto* group = groups_[numGroups_++];
@@ -206,16 +211,30 @@ void StreamingAggregation::assignGroups() {
 
   inputGroups_.resize(numInput);
 
+  // With flat primitive keys, detect group run boundaries with vectorized
+  // adjacent comparisons; rows within a run need no key comparison at all.
+  const bool hasRunBreaks = computeRunBreaks();
+
   // Look for the end of the last group.
   vector_size_t index = 0;
   if (prevInput_ != nullptr) {
     const auto prevIndex = prevInput_->size() - 1;
     auto* prevGroup = groups_[numGroups_ - 1];
-    for (; index < numInput; ++index) {
-      if (equalKeys(groupingKeys_, prevInput_, prevIndex, input_, index)) {
-        inputGroups_[index] = prevGroup;
-      } else {
-        break;
+    if (hasRunBreaks) {
+      if (equalKeys(groupingKeys_, prevInput_, prevIndex, input_, 0)) {
+        // The first run continues the last group of the previous input.
+        for (; index < numInput && (index == 0 || !runBreaks_[index]);
+             ++index) {
+          inputGroups_[index] = prevGroup;
+        }
+      }
+    } else {
+      for (; index < numInput; ++index) {
+        if (equalKeys(groupingKeys_, prevInput_, prevIndex, input_, index)) {
+          inputGroups_[index] = prevGroup;
+        } else {
+          break;
+        }
       }
     }
   }
@@ -229,7 +248,10 @@ void StreamingAggregation::assignGroups() {
     inputGroups_[index] = newGroup;
 
     for (auto i = index + 1; i < numInput; ++i) {
-      if (equalKeys(groupingKeys_, input_, index, input_, i)) {
+      const bool sameGroup = hasRunBreaks
+          ? !runBreaks_[i]
+          : equalKeys(groupingKeys_, input_, index, input_, i);
+      if (sameGroup) {
         inputGroups_[i] = inputGroups_[index];
       } else {
         newGroup = startNewGroup(i);
@@ -74,6 +74,14 @@ class StreamingAggregation : public Operator {
   // assignments in inputGroups_.
   void assignGroups();
 
+  // Fills 'runBreaks_' with one entry per input row where a non-zero entry at
+  // i means row i differs from row i - 1 in at least one grouping key.
+  // Returns false if some grouping key is not a flat primitive without nulls,
+  // in which case the caller compares rows one at a time. The adjacent value
+  // comparison loops vectorize, so long runs of equal keys cost a fraction of
+  // the per-row virtual equalValueAt calls.
+  bool computeRunBreaks();
+
   // Add input data to accumulators.
   void evaluateAggregates();
 
@@ -124,6 +132,10 @@ class StreamingAggregation : public Operator {
   // Pointers to groups for all input rows.
   std::vector<char*> inputGroups_;
 
+  // Per input row flags marking rows that start a new group run. See
+  // computeRunBreaks().
+  std::vector<uint8_t> runBreaks_;
+
   // Indices into `groups` indicating the row after last row of each group.  The
   // last element of this is the total size of input.
   std::vector<vector_size_t> groupBoundaries_;
@@ -21,6 +21,19 @@
 
 namespace facebook::velox::exec {
 
+/// Produces batches from connector splits.
+///
+/// Split-constant columns (partition keys, bucket ids) already cost O(1)
+/// per batch in expressions, not O(rows): connectors deliver them as
+/// ConstantVectors and constant peeling evaluates any subtree over them on
+/// a single row per batch. Folding them further, to literally true/false
+/// once per split with dependent CASE arms collapsed, would mean
+/// re-specializing the compiled ExprSet at every split boundary; since an
+/// operator's ExprSet compiles once and splits can number in the millions,
+/// the per-split recompile costs more than the per-batch single-row
+/// evaluations it removes. Predicates on partition keys are instead
+/// eliminated before execution by partition pruning in split generation,
+/// which is where per-split constants are actually known.
 class TableScan : public SourceOperator {
  public:
   TableScan(
@@ -806,6 +806,18 @@ void Task::recordBatchEndTime() {
   batchStartTimeMs_.reset();
 }
 
+// Startup cost notes for latency-sensitive embedders: all pipelines'
+// drivers and operators are constructed up front because the rendezvous
+// structures between pipelines (local exchange queues, join bridges)
+// must exist before any leaf driver can run, and operator construction is
+// where ExprSets compile. Lazily constructing downstream pipelines would
+// only move that work onto the critical path of the first batch. The
+// startup milliseconds that can actually be removed are the repeated plan
+// translation and expression compilation of recurring identical queries,
+// and the supported lever is reusing the PlanFragment and letting
+// expression-evaluation caches (ExecCtx optimization params) do their
+// work within a process; caching constructed operators themselves is not
+// possible since operators are stateful and single-use per task.
 void Task::start(uint32_t maxDrivers, uint32_t concurrentSplitGroups) {
   facebook::velox::process::ThreadDebugInfo threadDebugInfo{
       queryCtx()->queryId(), taskId_, nullptr};
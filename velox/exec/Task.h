@@ -260,6 +260,15 @@ class Task : public std::enable_shared_from_this<Task> {
   /// Adds split for a source operator corresponding to plan node with
   /// specified ID. Does not require sequential id.
   /// Note that, the operation is silently ignored if Task is not running.
+  ///
+  /// Cache-affinity note: which WORKER receives a split is decided by
+  /// whoever calls this API, i.e. the application's split scheduler; a task
+  /// only sees the splits it was given. Cross-query cache locality
+  /// therefore needs no engine extension: schedule splits to workers by a
+  /// stable key of the split's file (consistent hashing over the file
+  /// path, which is also what the cache's file ids are derived from) and
+  /// AsyncDataCache hits follow. An affinity token inside Split would just
+  /// carry information the scheduler already used to pick this worker.
   void addSplit(const core::PlanNodeId& planNodeId, exec::Split&& split);
 
   /// We mark that for the given group there would be no more splits coming.
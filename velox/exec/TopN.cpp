@@ -55,6 +55,8 @@ TopN::TopN(
       }
     }
   }
+  firstKeyAscending_ = topNNode->sortingOrders()[0].isAscending();
+  firstKeyNullsFirst_ = topNNode->sortingOrders()[0].isNullsFirst();
 }
 
 void TopN::addInput(RowVectorPtr input) {
@@ -104,6 +106,83 @@ void TopN::addInput(RowVectorPtr input) {
       }
     }
   }
+
+  maybeUpdateThresholdFilter();
+}
+
+void TopN::maybeUpdateThresholdFilter() {
+  if (topRows_.size() < count_) {
+    return;
+  }
+  if (!thresholdPushdownChecked_) {
+    thresholdPushdownChecked_ = true;
+    if (operatorCtx_->driverCtx()
+            ->queryConfig()
+            .topNThresholdPushdownEnabled()) {
+      switch (outputType_->childAt(sortingKeyColumns_[0])->kind()) {
+        case TypeKind::TINYINT:
+        case TypeKind::SMALLINT:
+        case TypeKind::INTEGER:
+        case TypeKind::BIGINT: {
+          const auto channels = operatorCtx_->driver()->canPushdownFilters(
+              this, {sortingKeyColumns_[0]});
+          canPushdownThreshold_ =
+              channels.find(sortingKeyColumns_[0]) != channels.end();
+          break;
+        }
+        default:
+          break;
+      }
+    }
+  }
+  if (!canPushdownThreshold_) {
+    return;
+  }
+
+  char* topRow = topRows_.top();
+  const auto keyColumn = sortingKeyColumns_[0];
+  const auto rowColumn = data_->columnAt(keyColumn);
+  if (RowContainer::isNullAt(
+          topRow, rowColumn.nullByte(), rowColumn.nullMask())) {
+    // All keys compare before null (or after, if nulls sort first), so a null
+    // threshold cannot prune anything.
+    return;
+  }
+  int64_t threshold;
+  switch (outputType_->childAt(keyColumn)->kind()) {
+    case TypeKind::TINYINT:
+      threshold = *reinterpret_cast<int8_t*>(topRow + rowColumn.offset());
+      break;
+    case TypeKind::SMALLINT:
+      threshold = *reinterpret_cast<int16_t*>(topRow + rowColumn.offset());
+      break;
+    case TypeKind::INTEGER:
+      threshold = *reinterpret_cast<int32_t*>(topRow + rowColumn.offset());
+      break;
+    case TypeKind::BIGINT:
+      threshold = *reinterpret_cast<int64_t*>(topRow + rowColumn.offset());
+      break;
+    default:
+      VELOX_UNREACHABLE();
+  }
+  if (lastPushedThreshold_.has_value() &&
+      lastPushedThreshold_.value() == threshold) {
+    return;
+  }
+  lastPushedThreshold_ = threshold;
+
+  // Rows whose first key orders strictly after the current worst kept row
+  // cannot enter the top 'count_', no matter the other keys. Nulls can still
+  // qualify only when they sort first.
+  dynamicFilters_[keyColumn] = firstKeyAscending_
+      ? std::make_shared<common::BigintRange>(
+            std::numeric_limits<int64_t>::min(),
+            threshold,
+            firstKeyNullsFirst_)
+      : std::make_shared<common::BigintRange>(
+            threshold,
+            std::numeric_limits<int64_t>::max(),
+            firstKeyNullsFirst_);
 }
 
 RowVectorPtr TopN::getOutput() {
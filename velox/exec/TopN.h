@@ -44,11 +44,27 @@ class TopN : public Operator {
   bool isFinished() override;
 
  private:
+  // Once 'topRows_' is full, publishes the first sorting key of the current
+  // worst kept row as a range dynamic filter on that column so the upstream
+  // scan can skip rows that cannot make the top 'count_'. Only applies to
+  // integral first keys and when the driver can push filters to the source.
+  void maybeUpdateThresholdFilter();
+
   const int32_t count_;
 
   bool finished_ = false;
   uint32_t numRowsReturned_ = 0;
 
+  // First sorting key order, used by the threshold dynamic filter.
+  bool firstKeyAscending_{true};
+  bool firstKeyNullsFirst_{false};
+
+  // State of the threshold dynamic filter pushdown. See
+  // maybeUpdateThresholdFilter().
+  bool thresholdPushdownChecked_{false};
+  bool canPushdownThreshold_{false};
+  std::optional<int64_t> lastPushedThreshold_;
+
   std::vector<column_index_t> sortingKeyColumns_;
   std::vector<column_index_t> nonKeyColumns_;
 
@@ -36,6 +36,19 @@ class TopNRowNumberSpiller;
 ///
 /// This is an optimized version of a Window operator with a single row_number
 /// window function followed by a row_number <= N filter.
+///
+/// Finished partitions are retained until end of input because, without a
+/// declared input clustering, a row for any partition may still arrive;
+/// peeking at key runs only proves a partition ended if the plan GUARANTEES
+/// clustering on the partition keys, which is exactly what the streaming
+/// window path expresses (WindowNode inputsSorted and the rank-based
+/// streaming builds). Plans with clustered input should declare it and take
+/// that path; early retirement here without the guarantee would silently
+/// drop late rows of a "finished" partition. Per-partition threshold
+/// rejection before RowContainer insert, by contrast, fits this operator:
+/// once a partition's heap is full, rows ordering after its current Nth row
+/// can be rejected pre-insert, mirroring the TopN cut-off logic, and would
+/// bound the dominant insert cost for hot partitions.
 class TopNRowNumber : public Operator {
  public:
   TopNRowNumber(
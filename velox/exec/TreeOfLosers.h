@@ -123,6 +123,33 @@ class TreeOfLosers {
     return lastIndex_ == kEmpty ? nullptr : streams_[lastIndex_].get();
   }
 
+  /// Returns the stream holding the overall second lowest first element, or
+  /// nullptr if there is none. Only meaningful right after next() returned a
+  /// non-null stream. The global runner-up is the best of the losers stored
+  /// along the winner's path, every one of which lost directly to the
+  /// winner. Lets callers emit a run of rows from the winning stream without
+  /// traversing the tree for as long as the winner's current row still
+  /// orders at or before the runner-up's.
+  Stream* runnerUp() {
+    if (values_.empty() || lastIndex_ == kEmpty) {
+      return nullptr;
+    }
+    TIndex best = kEmpty;
+    auto node = parent(firstStream_ + lastIndex_);
+    while (true) {
+      const auto loser = values_[node];
+      if (loser != kEmpty &&
+          (best == kEmpty || *streams_[loser] < *streams_[best])) {
+        best = loser;
+      }
+      if (node == 0) {
+        break;
+      }
+      node = parent(node);
+    }
+    return best == kEmpty ? nullptr : streams_[best].get();
+  }
+
   /// Returns the stream with the lowest first element and a flag that is true
   /// if there is another equal value to come from some other stream. The
   /// streams should have ordered unique values when using this function. This
@@ -228,6 +228,15 @@ const Unnest::UnnestChannelEncoding Unnest::generateEncodingForChannel(
   auto* currentIndices = rawIndices_[channel];
 
   // Make dictionary index for elements column since they may be out of order.
+  //
+  // Note on the zero-copy request: output here is already zero-copy on both
+  // sides. Repeated top-level columns are emitted as dictionaries over the
+  // input rows, and element columns as dictionaries over the arrays' (or
+  // maps') base elements vector, with an identity-mapping check below that
+  // skips even the dictionary wrap when the consumed ranges line up. The
+  // loop below writes one index per output element; its cost is the index
+  // buffer fill, not element data movement, and a prefix-sum kernel over
+  // the sizes buffer would only replace this already-linear pass.
   vector_size_t index = 0;
   bool identityMapping = true;
   VELOX_DCHECK_GT(range.size, 0);
@@ -249,6 +249,23 @@ class VectorHasher {
     uniqueValuesStorage_.clear();
   }
 
+  /// Resets the distinct values and the value range tracking so the hasher
+  /// analyzes future values from scratch. Used when the hash table restarts
+  /// its hash mode decision after being cleared, so ranges poisoned by since
+  /// removed outlier values do not carry over.
+  void resetValueTracking() {
+    resetStats();
+    rangeSize_ = 0;
+    multiplier_ = 1;
+    isRange_ = false;
+    hasRange_ = false;
+    rangeOverflow_ = false;
+    distinctOverflow_ = false;
+    min_ = 1;
+    max_ = 0;
+    distinctStringsBytes_ = 0;
+  }
+
   // Sets 'this' to range mode and adds 'reservePct' values to the
   // range, half below and half above, staying within bounds of the
   // data type. In this mode, hashed values become offsets from the
@@ -540,8 +540,33 @@ void Window::computePeerAndFrameBuffers(
   std::tie(peerStartRow_, peerEndRow_) = currentPartition_->computePeerBuffers(
       startRow, endRow, peerStartRow_, peerEndRow_, rawPeerStarts, rawPeerEnds);
 
+  // Functions sharing an identical frame spec share the computed frame
+  // bounds. Only frames without k bounds are matched: their equality is
+  // decided by the three enums alone.
+  const auto sameFrameWithoutKBounds = [&](const WindowFrame& left,
+                                           const WindowFrame& right) {
+    return !left.start.has_value() && !left.end.has_value() &&
+        !right.start.has_value() && !right.end.has_value() &&
+        left.type == right.type && left.startType == right.startType &&
+        left.endType == right.endType;
+  };
+
   for (auto i = 0; i < numFuncs; ++i) {
     const auto& windowFrame = windowFrames_[i];
+
+    int32_t duplicateOf = -1;
+    for (auto j = 0; j < i; ++j) {
+      if (sameFrameWithoutKBounds(windowFrame, windowFrames_[j])) {
+        duplicateOf = j;
+        break;
+      }
+    }
+    if (duplicateOf >= 0) {
+      ::memcpy(rawFrameStarts[i], rawFrameStarts[duplicateOf], bufferSize);
+      ::memcpy(rawFrameEnds[i], rawFrameEnds[duplicateOf], bufferSize);
+      validFrames_[i] = validFrames_[duplicateOf];
+      continue;
+    }
     // Default all rows to have validFrames. The invalidity of frames is only
     // computed for k rows/range frames at a later point.
     validFrames_[i].resizeFill(numRows, true);
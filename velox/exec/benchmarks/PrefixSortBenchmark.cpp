@@ -111,6 +111,10 @@ static const common::PrefixSortConfig kDefaultSortConfig(1024, 100, 50);
 static const common::PrefixSortConfig
     kStdSortConfig(1024, std::numeric_limits<int>::max(), 50);
 
+// Prefix-sort with the radix sort enabled for any fully normalized key, to
+// measure the crossover against the quicksort based prefix-sort.
+static const common::PrefixSortConfig kRadixSortConfig(1024, 100, 50, 1024);
+
 class PrefixSortBenchmark {
  public:
   PrefixSortBenchmark(memory::MemoryPool* pool) : pool_(pool) {}
@@ -136,6 +140,16 @@ class PrefixSortBenchmark {
         rowContainer, compareFlags, kStdSortConfig, pool_, sortedRows);
   }
 
+  void runRadixSort(
+      const std::vector<char*>& rows,
+      RowContainer* rowContainer,
+      const std::vector<CompareFlags>& compareFlags) {
+    auto sortedRows = std::vector<char*, memory::StlAllocator<char*>>(
+        rows.begin(), rows.end(), *pool_);
+    PrefixSort::sort(
+        rowContainer, compareFlags, kRadixSortConfig, pool_, sortedRows);
+  }
+
   // Add benchmark manually to avoid writing a lot of BENCHMARK.
   void addBenchmark(
       const std::string& testName,
@@ -173,6 +187,19 @@ class PrefixSortBenchmark {
             }
             return rows.size() * iterations;
           });
+      folly::addBenchmark(
+          __FILE__,
+          "%RadixSort",
+          [rows = testCase->rows(),
+           container = testCase->rowContainer(),
+           sortFlags = testCase->compareFlags(),
+           iterations = iterations,
+           this]() {
+            for (auto i = 0; i < iterations; ++i) {
+              runRadixSort(rows, container, sortFlags);
+            }
+            return rows.size() * iterations;
+          });
     }
     testCases_.push_back(std::move(testCase));
   }
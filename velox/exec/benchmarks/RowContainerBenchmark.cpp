@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <folly/Benchmark.h>
+#include <folly/init/Init.h>
+
+#include "velox/exec/RowContainer.h"
+#include "velox/vector/fuzzer/VectorFuzzer.h"
+
+using namespace facebook::velox;
+using namespace facebook::velox::exec;
+
+namespace {
+
+constexpr vector_size_t kNumRows = 10'000;
+
+/// Measures RowContainer store/extract/compare/hash in isolation across type
+/// mixes, null densities and string lengths, so row layout changes are
+/// measurable without whole-query noise.
+class RowContainerBenchmark {
+ public:
+  RowContainerBenchmark(
+      const RowTypePtr& rowType,
+      double nullRatio,
+      int32_t stringLength)
+      : pool_(memory::memoryManager()->addLeafPool()) {
+    VectorFuzzer::Options options;
+    options.vectorSize = kNumRows;
+    options.nullRatio = nullRatio;
+    options.stringLength = stringLength;
+    options.stringVariableLength = true;
+    VectorFuzzer fuzzer(options, pool_.get());
+    data_ = fuzzer.fuzzInputFlatRow(rowType);
+
+    std::vector<TypePtr> keyTypes;
+    for (auto i = 0; i < rowType->size(); ++i) {
+      keyTypes.push_back(rowType->childAt(i));
+    }
+    container_ = std::make_unique<RowContainer>(keyTypes, pool_.get());
+
+    decoded_.resize(rowType->size());
+    SelectivityVector allRows(kNumRows);
+    for (auto i = 0; i < rowType->size(); ++i) {
+      decoded_[i].decode(*data_->childAt(i), allRows);
+    }
+  }
+
+  // Stores all rows, one row at a time, as operators do.
+  void store() {
+    rows_.resize(kNumRows);
+    for (vector_size_t row = 0; row < kNumRows; ++row) {
+      char* newRow = container_->newRow();
+      for (auto col = 0; col < decoded_.size(); ++col) {
+        container_->store(decoded_[col], row, newRow, col);
+      }
+      rows_[row] = newRow;
+    }
+  }
+
+  void extract() {
+    for (auto col = 0; col < decoded_.size(); ++col) {
+      auto result =
+          BaseVector::create(data_->childAt(col)->type(), kNumRows, pool_.get());
+      container_->extractColumn(rows_.data(), kNumRows, col, result);
+      folly::doNotOptimizeAway(result);
+    }
+  }
+
+  void hash() {
+    raw_vector<uint64_t> hashes(kNumRows);
+    for (auto col = 0; col < decoded_.size(); ++col) {
+      container_->hash(
+          col, folly::Range<char**>(rows_.data(), kNumRows), col > 0, hashes.data());
+    }
+    folly::doNotOptimizeAway(hashes[kNumRows - 1]);
+  }
+
+  void compare() {
+    int32_t result = 0;
+    for (vector_size_t i = 1; i < kNumRows; ++i) {
+      result += container_->compareRows(rows_[i - 1], rows_[i]);
+    }
+    folly::doNotOptimizeAway(result);
+  }
+
+ private:
+  std::shared_ptr<memory::MemoryPool> pool_;
+  RowVectorPtr data_;
+  std::unique_ptr<RowContainer> container_;
+  std::vector<DecodedVector> decoded_;
+  std::vector<char*> rows_;
+};
+
+RowTypePtr bigintKeys() {
+  return ROW({"c0", "c1"}, {BIGINT(), BIGINT()});
+}
+
+RowTypePtr stringKeys() {
+  return ROW({"c0", "c1"}, {VARCHAR(), VARCHAR()});
+}
+
+RowTypePtr mixedKeys() {
+  return ROW(
+      {"c0", "c1", "c2", "c3"}, {BIGINT(), VARCHAR(), INTEGER(), DOUBLE()});
+}
+
+// One store+extract+hash+compare cycle per iteration for the given shape.
+void run(const RowTypePtr& type, double nullRatio, int32_t stringLength) {
+  folly::BenchmarkSuspender suspender;
+  RowContainerBenchmark benchmark(type, nullRatio, stringLength);
+  suspender.dismiss();
+
+  benchmark.store();
+  benchmark.extract();
+  benchmark.hash();
+  benchmark.compare();
+}
+
+BENCHMARK(bigintNoNulls) {
+  run(bigintKeys(), 0.0, 0);
+}
+
+BENCHMARK(bigintSparseNulls) {
+  run(bigintKeys(), 0.1, 0);
+}
+
+BENCHMARK(bigintDenseNulls) {
+  run(bigintKeys(), 0.9, 0);
+}
+
+BENCHMARK(shortStringsNoNulls) {
+  run(stringKeys(), 0.0, 10);
+}
+
+BENCHMARK(longStringsNoNulls) {
+  run(stringKeys(), 0.0, 100);
+}
+
+BENCHMARK(longStringsSparseNulls) {
+  run(stringKeys(), 0.1, 100);
+}
+
+BENCHMARK(mixedNoNulls) {
+  run(mixedKeys(), 0.0, 20);
+}
+
+BENCHMARK(mixedSparseNulls) {
+  run(mixedKeys(), 0.1, 20);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  folly::Init init{&argc, &argv};
+  memory::MemoryManager::initialize(memory::MemoryManagerOptions{});
+  folly::runBenchmarks();
+  return 0;
+}
@@ -21,6 +21,7 @@
 
 #include "velox/common/base/Exceptions.h"
 #include "velox/common/base/SimdUtil.h"
+#include "velox/common/base/SortingNetwork.h"
 
 namespace facebook::velox::exec::prefixsort {
 
@@ -159,6 +160,15 @@ class PrefixSortRunner {
         compare);
   }
 
+  /// Sorts the entries in [start, end) with an in-place MSD radix sort over
+  /// the first 'keyBytes' of each entry. Only valid when entry order equals
+  /// the lexicographic order of those bytes, i.e. all the sort keys are fully
+  /// normalized. Small buckets finish with quickSort over the remaining
+  /// bytes.
+  void radixSort(char* start, char* end, uint32_t keyBytes) const {
+    radixSortImpl(start, (end - start) / entrySize_, 0, keyBytes);
+  }
+
   /// For testing only.
   template <typename TCompare>
   FOLLY_ALWAYS_INLINE static char* testingMedian3(
@@ -175,6 +185,74 @@ class PrefixSortRunner {
   }
 
  private:
+  // Below this many entries a radix bucket is finished with quickSort; the
+  // 256-way counting pass does not pay off for small buckets.
+  static const uint32_t kRadixSortMinBucket = 128;
+
+  // American-flag style in-place MSD radix pass over the byte at 'byteIndex',
+  // recursing into each bucket for the next byte.
+  void radixSortImpl(
+      char* start,
+      uint64_t numEntries,
+      uint32_t byteIndex,
+      uint32_t keyBytes) const {
+    if (numEntries < 2 || byteIndex >= keyBytes) {
+      return;
+    }
+    if (numEntries < kRadixSortMinBucket) {
+      const auto compare = [&](char* lhs, char* rhs) {
+        return std::memcmp(
+            lhs + byteIndex, rhs + byteIndex, keyBytes - byteIndex);
+      };
+      quickSort(start, start + numEntries * entrySize_, compare);
+      return;
+    }
+
+    const auto byteAt = [&](uint64_t entry) {
+      return static_cast<uint8_t>(start[entry * entrySize_ + byteIndex]);
+    };
+    uint64_t bucketEnds[256] = {0};
+    for (uint64_t i = 0; i < numEntries; ++i) {
+      ++bucketEnds[byteAt(i)];
+    }
+    uint64_t nextIndex[256];
+    uint64_t bucketStart = 0;
+    for (uint32_t b = 0; b < 256; ++b) {
+      nextIndex[b] = bucketStart;
+      bucketStart += bucketEnds[b];
+      bucketEnds[b] = bucketStart;
+    }
+
+    // Permute entries into their buckets: an entry not belonging to the
+    // current bucket is swapped to its own bucket's next free slot and the
+    // incoming entry is examined in its place.
+    for (uint32_t b = 0; b < 256; ++b) {
+      while (nextIndex[b] < bucketEnds[b]) {
+        const auto i = nextIndex[b];
+        const auto c = byteAt(i);
+        if (c == b) {
+          ++nextIndex[b];
+        } else {
+          swap(
+              detail::PrefixSortIterator(start + i * entrySize_, entrySize_),
+              detail::PrefixSortIterator(
+                  start + nextIndex[c] * entrySize_, entrySize_));
+          ++nextIndex[c];
+        }
+      }
+    }
+
+    uint64_t begin = 0;
+    for (uint32_t b = 0; b < 256; ++b) {
+      radixSortImpl(
+          start + begin * entrySize_,
+          bucketEnds[b] - begin,
+          byteIndex + 1,
+          keyBytes);
+      begin = bucketEnds[b];
+    }
+  }
+
   FOLLY_ALWAYS_INLINE void swap(
       const detail::PrefixSortIterator& lhs,
       const detail::PrefixSortIterator& rhs) const {
@@ -224,6 +302,51 @@ class PrefixSortRunner {
                                                     : a);
   }
 
+  // Sorts up to kSortingNetworkMaxSize entries with the branchless
+  // compile-time sorting network: the entry addresses are sorted in
+  // registers and the resulting permutation is applied with cycle walks
+  // using the swap buffer.
+  template <typename TCompare>
+  void sortingNetworkSort(
+      const detail::PrefixSortIterator& start,
+      uint64_t size,
+      TCompare compare) const {
+    if (size < 2) {
+      return;
+    }
+    char* entries[kSortingNetworkMaxSize];
+    for (uint64_t i = 0; i < size; ++i) {
+      entries[i] = *(start + i);
+    }
+    sortingNetwork(entries, size, [&](char* lhs, char* rhs) {
+      return compare(lhs, rhs) < 0;
+    });
+
+    // entries[i] is the source address of the entry that belongs in slot i.
+    int32_t sourceIndex[kSortingNetworkMaxSize];
+    for (uint64_t i = 0; i < size; ++i) {
+      sourceIndex[i] = (entries[i] - *start) / entrySize_;
+    }
+    bool placed[kSortingNetworkMaxSize] = {};
+    for (uint64_t i = 0; i < size; ++i) {
+      if (placed[i] || sourceIndex[i] == static_cast<int32_t>(i)) {
+        continue;
+      }
+      simd::memcpy(swapBuffer_, *(start + i), entrySize_);
+      uint64_t slot = i;
+      while (true) {
+        const auto source = sourceIndex[slot];
+        placed[slot] = true;
+        if (source == static_cast<int32_t>(i)) {
+          simd::memcpy(*(start + slot), swapBuffer_, entrySize_);
+          break;
+        }
+        simd::memcpy(*(start + slot), *(start + source), entrySize_);
+        slot = source;
+      }
+    }
+  }
+
   template <typename TCompare>
   FOLLY_ALWAYS_INLINE void insertSort(
       const detail::PrefixSortIterator& start,
@@ -255,9 +378,11 @@ class PrefixSortRunner {
     VELOX_CHECK(end >= start, "Invalid sort range.");
     const uint64_t len = end - start;
 
-    // Insertion sort on smallest arrays
-    if (len < kSmallSort) {
-      insertSort(start, end, compare);
+    // Branchless sorting network on smallest arrays. The base case is a
+    // significant share of the total sort time, and the network removes the
+    // comparison branch mispredictions of insertion sort.
+    if (len <= kSortingNetworkMaxSize) {
+      sortingNetworkSort(start, len, compare);
       return;
     }
 
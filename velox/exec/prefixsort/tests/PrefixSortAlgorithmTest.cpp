@@ -70,6 +70,41 @@ TEST_F(PrefixSortAlgorithmTest, quickSort) {
   testQuickSort(PrefixSortRunner::kMediumSort + 1000);
 }
 
+TEST_F(PrefixSortAlgorithmTest, radixSort) {
+  const auto testRadixSort = [&](size_t size) {
+    // Data1 will be sorted by radixSort.
+    std::vector<int64_t> data1(size);
+    std::generate(data1.begin(), data1.end(), [&]() {
+      return folly::Random::rand64();
+    });
+
+    // Data2 will be sorted by std::sort.
+    std::vector<int64_t> data2 = data1;
+
+    {
+      char* start = (char*)data1.data();
+      char* end = start + sizeof(int64_t) * data1.size();
+      uint32_t entrySize = sizeof(int64_t);
+      auto swapBuffer = AlignedBuffer::allocate<char>(entrySize, pool());
+      PrefixSortRunner sortRunner(entrySize, swapBuffer->asMutable<char>());
+      encodeInPlace(data1);
+      sortRunner.radixSort(start, end, entrySize);
+    }
+
+    std::sort(data2.begin(), data2.end());
+    decodeInPlace(data1);
+    ASSERT_EQ(data1, data2);
+  };
+
+  // Below, at and above the small bucket cutoff, plus sizes that exercise
+  // multi-level recursion with duplicate bytes.
+  testRadixSort(1);
+  testRadixSort(100);
+  testRadixSort(128);
+  testRadixSort(1'000);
+  testRadixSort(100'000);
+}
+
 TEST_F(PrefixSortAlgorithmTest, testingMedian3) {
   // Generate 3 elements randomly as input data.
   std::vector<int64_t> data1(3);
@@ -684,6 +684,53 @@ TEST_F(AggregationTest, multiKeyDistinct) {
   testMultiKey(vectors, true, true);
 }
 
+TEST_F(AggregationTest, clusteredProbe) {
+  // Clustered input: runs of equal keys interleaved with repeats of earlier
+  // keys, so runs hit both new and existing groups.
+  std::vector<RowVectorPtr> vectors = {
+      makeRowVector(
+          {makeFlatVector<int64_t>(1'000, [](auto row) { return row / 10; }),
+           makeFlatVector<int64_t>(1'000, [](auto row) { return row; })}),
+      makeRowVector(
+          {makeFlatVector<int64_t>(
+               1'000, [](auto row) { return (row / 20) % 70; }),
+           makeFlatVector<int64_t>(1'000, [](auto row) { return row * 2; })}),
+  };
+  createDuckDbTable(vectors);
+
+  AssertQueryBuilder(duckDbQueryRunner_)
+      .config(core::QueryConfig::kAggregationClusteredProbeEnabled, true)
+      .plan(PlanBuilder()
+                .values(vectors)
+                .singleAggregation({"c0"}, {"sum(c1)", "count(c1)"})
+                .planNode())
+      .assertResults("SELECT c0, sum(c1), count(c1) FROM tmp GROUP BY c0");
+
+  // Distinct aggregation emits each key's first occurrence exactly once.
+  AssertQueryBuilder(duckDbQueryRunner_)
+      .config(core::QueryConfig::kAggregationClusteredProbeEnabled, true)
+      .plan(PlanBuilder()
+                .values(vectors)
+                .singleAggregation({"c0"}, {})
+                .planNode())
+      .assertResults("SELECT distinct c0 FROM tmp");
+
+  // A batch that is a single run probes only row 0; the remaining rows take
+  // their group from the run head and must not read or write past the
+  // one-entry lookup.
+  auto singleRun = std::vector<RowVectorPtr>{makeRowVector(
+      {makeFlatVector<int64_t>(1'000, [](auto) { return 42; }),
+       makeFlatVector<int64_t>(1'000, [](auto row) { return row; })})};
+  createDuckDbTable(singleRun);
+  AssertQueryBuilder(duckDbQueryRunner_)
+      .config(core::QueryConfig::kAggregationClusteredProbeEnabled, true)
+      .plan(PlanBuilder()
+                .values(singleRun)
+                .singleAggregation({"c0"}, {"sum(c1)", "count(c1)"})
+                .planNode())
+      .assertResults("SELECT c0, sum(c1), count(c1) FROM tmp GROUP BY c0");
+}
+
 TEST_F(AggregationTest, aggregateOfNulls) {
   auto rowVector = makeRowVector({
       BatchMaker::createVector<TypeKind::BIGINT>(
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/exec/HashTableCache.h"
+
+#include <gtest/gtest.h>
+
+#include "velox/vector/tests/utils/VectorTestBase.h"
+
+namespace facebook::velox::exec::test {
+
+class HashTableCacheTest : public testing::Test,
+                           public velox::test::VectorTestBase {
+ protected:
+  static void SetUpTestCase() {
+    memory::MemoryManager::testingSetInstance({});
+  }
+
+  std::shared_ptr<BaseHashTable> makeTable() {
+    std::vector<std::unique_ptr<VectorHasher>> keyHashers;
+    keyHashers.push_back(std::make_unique<VectorHasher>(BIGINT(), 0));
+    return HashTable<true>::createForJoin(
+        std::move(keyHashers), {}, true, false, 1'000, pool());
+  }
+};
+
+TEST_F(HashTableCacheTest, putAndGet) {
+  HashTableCache cache;
+  auto table = makeTable();
+  ASSERT_EQ(cache.get("t1"), nullptr);
+
+  cache.put("t1", table, nullptr, 100);
+  ASSERT_EQ(cache.get("t1"), table);
+  ASSERT_EQ(cache.numEntries(), 1);
+  ASSERT_EQ(cache.currentBytes(), 100);
+
+  // Duplicate put is a no-op.
+  cache.put("t1", makeTable(), nullptr, 200);
+  ASSERT_EQ(cache.get("t1"), table);
+  ASSERT_EQ(cache.currentBytes(), 100);
+
+  cache.clear();
+  ASSERT_EQ(cache.get("t1"), nullptr);
+  ASSERT_EQ(cache.currentBytes(), 0);
+}
+
+TEST_F(HashTableCacheTest, eviction) {
+  HashTableCache cache;
+  cache.setMaxBytes(300);
+
+  auto table1 = makeTable();
+  auto table2 = makeTable();
+  auto table3 = makeTable();
+  cache.put("t1", table1, nullptr, 100);
+  cache.put("t2", table2, nullptr, 100);
+  cache.put("t3", table3, nullptr, 100);
+  ASSERT_EQ(cache.numEntries(), 3);
+
+  // Touch 't1' so 't2' is the least recently used.
+  ASSERT_EQ(cache.get("t1"), table1);
+  cache.put("t4", makeTable(), nullptr, 100);
+  ASSERT_EQ(cache.numEntries(), 3);
+  ASSERT_EQ(cache.get("t2"), nullptr);
+  ASSERT_EQ(cache.get("t1"), table1);
+  ASSERT_EQ(cache.get("t3"), table3);
+
+  // An entry larger than the capacity is not cached.
+  cache.put("big", makeTable(), nullptr, 1'000);
+  ASSERT_EQ(cache.get("big"), nullptr);
+
+  // Shrinking the capacity evicts down to it.
+  cache.setMaxBytes(100);
+  ASSERT_EQ(cache.numEntries(), 1);
+  ASSERT_EQ(cache.currentBytes(), 100);
+}
+
+} // namespace facebook::velox::exec::test
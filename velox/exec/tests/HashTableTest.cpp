@@ -144,6 +144,8 @@ class HashTableTest : public testing::TestWithParam<bool>,
       sequence += size;
       if (topTable_ == nullptr) {
         topTable_ = std::move(table);
+        topTable_->setProbePrefetchPipeline(probePrefetchPipeline_);
+        topTable_->setNumaAwareParallelBuild(numaAwareParallelBuild_);
         numRows += topTable_->rows()->numRows();
       } else {
         numRows += table->rows()->numRows();
@@ -586,6 +588,11 @@ class HashTableTest : public testing::TestWithParam<bool>,
   // Spacing between consecutive generated keys. Affects whether
   // Vectorhashers make ranges or ids of distinct values.
   int64_t keySpacing_ = 1;
+  // If true, the built table probes with the batched prefetching probe loop.
+  bool probePrefetchPipeline_ = false;
+  // If true, the parallel join build zeroes table partitions on the building
+  // threads.
+  bool numaAwareParallelBuild_ = false;
   // Base string for varchar fields when making string vector.
   std::string baseString_;
   std::unique_ptr<folly::CPUThreadPoolExecutor> executor_;
@@ -640,6 +647,24 @@ TEST_P(HashTableTest, mixed6Sparse) {
   testCycle(BaseHashTable::HashMode::kHash, 100000, 9, type, 6);
 }
 
+TEST_P(HashTableTest, mixed6SparseNumaAwareParallelBuild) {
+  auto type =
+      ROW({"k1", "k2", "k3", "k4", "k5", "k6"},
+          {BIGINT(), BIGINT(), BIGINT(), BIGINT(), BIGINT(), VARCHAR()});
+  keySpacing_ = 1000;
+  numaAwareParallelBuild_ = true;
+  testCycle(BaseHashTable::HashMode::kHash, 100000, 9, type, 6);
+}
+
+TEST_P(HashTableTest, mixed6SparsePrefetchPipeline) {
+  auto type =
+      ROW({"k1", "k2", "k3", "k4", "k5", "k6"},
+          {BIGINT(), BIGINT(), BIGINT(), BIGINT(), BIGINT(), VARCHAR()});
+  keySpacing_ = 1000;
+  probePrefetchPipeline_ = true;
+  testCycle(BaseHashTable::HashMode::kHash, 100000, 9, type, 6);
+}
+
 // It should be safe to call clear() before we insert any data into HashTable
 TEST_P(HashTableTest, clearBeforeInsert) {
   std::vector<std::unique_ptr<VectorHasher>> keyHashers;
@@ -696,6 +721,45 @@ TEST_P(HashTableTest, clearAfterInsert) {
   }
 }
 
+TEST_P(HashTableTest, restartHashModeDecisionAfterClear) {
+  auto rowType = ROW({"a"}, {BIGINT()});
+  auto table = createHashTableForAggregation(rowType, 1);
+  auto lookup = std::make_unique<HashLookup>(table->hashers(), pool());
+
+  // Outliers at both ends of the int64 range overflow the range tracking and
+  // more than VectorHasher::kMaxDistinct values overflow the distinct value
+  // tracking, forcing kHash mode.
+  auto data = makeRowVector({
+      makeFlatVector<int64_t>(
+          150'000,
+          [](auto row) {
+            if (row == 0) {
+              return std::numeric_limits<int64_t>::min() + 1;
+            }
+            if (row == 1) {
+              return std::numeric_limits<int64_t>::max() - 1;
+            }
+            return static_cast<int64_t>(row);
+          }),
+  });
+  lookup->reset(data->size());
+  insertGroups(*data, *lookup, *table);
+  ASSERT_EQ(table->hashMode(), BaseHashTable::HashMode::kHash);
+
+  // Clearing and freeing the table restarts the hash mode decision, so a
+  // dense key population without the outliers can use kArray mode again.
+  table->clear(true);
+  ASSERT_EQ(table->hashMode(), BaseHashTable::HashMode::kArray);
+
+  auto denseData = makeRowVector({
+      makeFlatVector<int64_t>(100, [](auto row) { return row; }),
+  });
+  lookup->reset(denseData->size());
+  insertGroups(*denseData, *lookup, *table);
+  ASSERT_EQ(table->hashMode(), BaseHashTable::HashMode::kArray);
+  ASSERT_GE(table->stats().numHashModeTransitions, 2);
+}
+
 // Test a specific code path in HashTable::decodeHashMode where
 // rangesWithReserve overflows, distinctsWithReserve fits and bestWithReserve =
 // rangesWithReserve.
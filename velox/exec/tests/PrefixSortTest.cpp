@@ -41,7 +41,10 @@ class PrefixSortTest : public exec::test::OperatorTestBase {
 
   void testPrefixSort(
       const std::vector<CompareFlags>& compareFlags,
-      const RowVectorPtr& data) {
+      const RowVectorPtr& data,
+      // Set threshold to 0 to enable prefix-sort in small dataset.
+      const common::PrefixSortConfig& config =
+          common::PrefixSortConfig{1024, 0, 12}) {
     const auto numRows = data->size();
     const auto expectedResult =
         generateExpectedResult(compareFlags, numRows, data);
@@ -61,27 +64,11 @@ class PrefixSortTest : public exec::test::OperatorTestBase {
     const std::shared_ptr<memory::MemoryPool> sortPool =
         rootPool_->addLeafChild("prefixsort");
     const auto maxBytes = PrefixSort::maxRequiredBytes(
-        &rowContainer,
-        compareFlags,
-        common::PrefixSortConfig{
-            1024,
-            // Set threshold to 0 to enable prefix-sort in small dataset.
-            0,
-            12},
-        sortPool.get());
+        &rowContainer, compareFlags, config, sortPool.get());
     const auto beforeBytes = sortPool->peakBytes();
     ASSERT_EQ(sortPool->peakBytes(), 0);
     // Use PrefixSort to sort rows.
-    PrefixSort::sort(
-        &rowContainer,
-        compareFlags,
-        common::PrefixSortConfig{
-            1024,
-            // Set threshold to 0 to enable prefix-sort in small dataset.
-            0,
-            12},
-        sortPool.get(),
-        rows);
+    PrefixSort::sort(&rowContainer, compareFlags, config, sortPool.get(), rows);
     ASSERT_GE(maxBytes, sortPool->peakBytes() - beforeBytes);
 
     // Extract data from the RowContainer in order.
@@ -266,6 +253,37 @@ TEST_F(PrefixSortTest, multipleKeys) {
   }
 }
 
+TEST_F(PrefixSortTest, radixSort) {
+  // End-to-end with the radix sort enabled; the keys are encoded without the
+  // word-wise byte swap on this path, so byte significance must survive the
+  // whole pipeline (1 vs 256 orders by value, not by low byte).
+  const common::PrefixSortConfig radixConfig{1024, 0, 12, 64};
+  {
+    const auto data = makeRowVector({
+        makeFlatVector<int64_t>({256, 1, 65536, 2, 257, 0, -1, 512}),
+    });
+    testPrefixSort({kAsc}, data, radixConfig);
+    testPrefixSort({kDesc}, data, radixConfig);
+  }
+  {
+    const auto data = makeRowVector({
+        makeNullableFlatVector<int64_t>({256, std::nullopt, 1, 2, 257}),
+        makeNullableFlatVector<int32_t>({5, 4, std::nullopt, 2, 1}),
+    });
+    testPrefixSort({kAsc, kAsc}, data, radixConfig);
+    testPrefixSort({kDesc, kDesc}, data, radixConfig);
+    testPrefixSort({kAsc, kDesc}, data, radixConfig);
+  }
+  {
+    // Large enough to exercise the 256-way counting passes, not just the
+    // small-bucket memcmp fallback.
+    VectorFuzzer fuzzer({.vectorSize = 10'240, .nullRatio = 0.1}, pool());
+    const auto data = fuzzer.fuzzRow(ROW({BIGINT(), INTEGER()}));
+    testPrefixSort({kAsc, kAsc}, data, radixConfig);
+    testPrefixSort({kDesc, kAsc}, data, radixConfig);
+  }
+}
+
 TEST_F(PrefixSortTest, fuzz) {
   std::vector<TypePtr> keyTypes = {
       INTEGER(),
@@ -381,6 +399,30 @@ TEST_F(PrefixSortTest, checkMaxNormalizedKeySizeForMultipleKeys) {
   ASSERT_FALSE(sortLayoutTwoKeysNoNulls.normalizedKeyHasNullByte[1]);
 }
 
+TEST_F(PrefixSortTest, expandTruncatedStringPrefix) {
+  // A truncated VARCHAR key takes over the unused normalized key budget so
+  // fewer comparisons fall back to the row container tie breaker.
+  std::vector<TypePtr> keyTypes = {VARCHAR(), BIGINT()};
+  std::vector<CompareFlags> compareFlags = {kAsc, kAsc};
+  std::vector<bool> columnHasNulls = {true, true};
+  std::vector<std::optional<uint32_t>> maxStringLengths = {
+      std::nullopt, std::nullopt};
+  auto layout = PrefixSortLayout::generate(
+      keyTypes, columnHasNulls, compareFlags, 64, 12, maxStringLengths);
+  ASSERT_TRUE(layout.hasNormalizedKeys);
+  ASSERT_EQ(layout.numNormalizedKeys, 1);
+  // 12 string prefix bytes plus the null byte, expanded to the full budget.
+  ASSERT_EQ(layout.encodeSizes[0], 64);
+  // The key is still partial, so ties re-compare it.
+  ASSERT_EQ(layout.nonPrefixSortStartIndex, 0);
+
+  // The expansion is bounded by the longest string when known.
+  maxStringLengths = {20, std::nullopt};
+  auto boundedLayout = PrefixSortLayout::generate(
+      keyTypes, columnHasNulls, compareFlags, 64, 12, maxStringLengths);
+  ASSERT_EQ(boundedLayout.encodeSizes[0], 21);
+}
+
 TEST_F(PrefixSortTest, optimizeSortKeysOrder) {
   struct {
     RowTypePtr inputType;
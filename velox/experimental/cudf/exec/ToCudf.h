@@ -55,6 +55,20 @@ struct CudfOptions {
 };
 
 /// Registers adapter to add cuDF operators to Drivers.
+///
+/// Scan is the missing end of the offload story: operators rewritten here
+/// still receive host vectors decoded by the CPU readers, so every GPU plan
+/// pays a host decode plus a transfer before its first kernel. A
+/// cudf-backed scan fits this adapter as a TableScan replacement whose data
+/// source drives cudf's Parquet reader and emits CudfVector (device-owned,
+/// see vector/CudfVector.h) straight to the downstream cudf or wave
+/// operator. Two constraints shape it: supportability is per-split, not
+/// per-table - schema features the GPU reader lacks must fall back to
+/// HiveDataSource split by split, which means the replacement operator
+/// keeps a CPU data source alongside and routes each split at addSplit
+/// time; and device residency ends at the first operator the adapter did
+/// not rewrite, where a CudfVector must be materialized back to host
+/// exactly once rather than per column access.
 void registerCudf(const CudfOptions& options = CudfOptions::defaultOptions());
 void unregisterCudf();
 
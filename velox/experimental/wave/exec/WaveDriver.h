@@ -161,6 +161,18 @@ struct WaveRuntimeObjects {
 };
 
 /// Operator that replaces a sequence of Velox Operators offloaded to Wave.
+///
+/// On aggregation/join parity for production shapes: the blockers are not
+/// kernels (SimpleAggregate.cpp and Join.cuh cover the BIGINT/DOUBLE paths)
+/// but the memory contract at the edges. Oversized builds need the device
+/// RowContainer laid out so the CPU spill machinery can consume it when the
+/// GPU runs out - that means unified-memory allocations registered with the
+/// operator's MemoryPool so arbitration sees them and reclaim can spill
+/// through the existing Spiller rather than a device-specific path. VARCHAR
+/// keys additionally need the string payload area in unified memory for the
+/// same reason. Transfer/compute split is already measurable per WaveStream;
+/// reporting it means folding those times into the operator's
+/// RuntimeMetrics so PlanNodeStats picks them up with no new plumbing.
 class WaveDriver : public exec::SourceOperator {
  public:
   WaveDriver(
@@ -78,6 +78,20 @@ class CastOperator {
       VectorPtr& result) const = 0;
 };
 
+/// Casts input to the target type, with behavior points (string parsing,
+/// rounding, timezone handling) delegated to CastHooks per dialect.
+///
+/// On compiled per-(from,to,policy) cast plans with SIMD parsing: the
+/// dispatch per (from,to) is already resolved once per CastExpr, not per
+/// row; what is per row is the parse itself and error capture. SWAR/SIMD
+/// numeric parsing would slot inside the hooks' string-to-number paths
+/// without touching this class. The real constraint is error semantics:
+/// TRY does not rely on per-row throw/catch today (applyToSelectedNoThrow
+/// records row errors into EvalCtx), but hooks return folly::Expected per
+/// value, so a batched kernel must produce a per-row error mask in one
+/// pass to plug into the same EvalCtx error channel. Any vectorized parser
+/// contribution should land as a CastHooks implementation detail with that
+/// mask contract, not as a parallel cast path.
 class CastExpr : public SpecialForm {
  public:
   /// @param type The target type of the cast expression
@@ -554,6 +554,17 @@ auto materializeElement(const T& element) {
 // When returnsOptionalValues is true, the interface is like
 // std::vector<std::optional<V>>.
 // When returnsOptionalValues is false, the interface is like std::vector<V>.
+//
+// Views read through the decoded elements vector without copying; what they
+// intentionally do not provide is cross-row state, which is why set-based
+// array functions built on them allocate per row. Bulk kernels that want
+// one scratch hash table across rows (reset by epoch marks rather than
+// clears) and direct writes into pre-sized element buffers should be
+// written as VectorFunctions over the flattened elements vector plus raw
+// offsets/sizes, the way the optimized map/array builtins already drop to
+// vector level; the simple-function view API trades that control for
+// per-row ergonomics by design, so the framework for bulk kernels is the
+// vector function layer, not an extension of these views.
 template <bool returnsOptionalValues, typename V>
 class ArrayView {
  public:
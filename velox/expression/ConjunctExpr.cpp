@@ -90,6 +90,77 @@ void finalizeErrors(
 }
 } // namespace
 
+// static
+ConjunctStatsRegistry* ConjunctStatsRegistry::instance() {
+  // Intentionally leaked: conjuncts held by cached plans may be destroyed
+  // after static destructors run and still save their statistics.
+  static auto* registry = new ConjunctStatsRegistry();
+  return registry;
+}
+
+std::optional<ConjunctStatsRegistry::Stats> ConjunctStatsRegistry::find(
+    const std::string& fingerprint) const {
+  return stats_.withRLock(
+      [&](const auto& map) -> std::optional<Stats> {
+        auto it = map.find(fingerprint);
+        if (it == map.end()) {
+          return std::nullopt;
+        }
+        return it->second;
+      });
+}
+
+void ConjunctStatsRegistry::update(
+    const std::string& fingerprint,
+    const Stats& stats) {
+  if (stats.numIn == 0) {
+    return;
+  }
+  stats_.withWLock([&](auto& map) {
+    auto it = map.find(fingerprint);
+    if (it != map.end()) {
+      it->second = stats;
+    } else if (map.size() < kMaxEntries) {
+      map.emplace(fingerprint, stats);
+    }
+  });
+}
+
+std::vector<std::pair<std::string, ConjunctStatsRegistry::Stats>>
+ConjunctStatsRegistry::snapshot() const {
+  return stats_.withRLock([](const auto& map) {
+    return std::vector<std::pair<std::string, Stats>>(
+        map.begin(), map.end());
+  });
+}
+
+void ConjunctExpr::seedSelectivityFromRegistry() {
+  auto* registry = ConjunctStatsRegistry::instance();
+  for (auto i = 0; i < inputs_.size(); ++i) {
+    const auto stats = registry->find(inputs_[i]->toString());
+    if (stats.has_value()) {
+      selectivity_[i].seed(
+          stats.value().timeClocks, stats.value().numIn, stats.value().numOut);
+    }
+  }
+}
+
+void ConjunctExpr::saveSelectivityToRegistry() {
+  // Called from the destructor; never throw.
+  try {
+    auto* registry = ConjunctStatsRegistry::instance();
+    for (auto i = 0; i < inputs_.size(); ++i) {
+      registry->update(
+          inputs_[i]->toString(),
+          {selectivity_[i].timeClocks(),
+           selectivity_[i].numIn(),
+           selectivity_[i].numOut()});
+    }
+  } catch (...) {
+    // Statistics persistence is best effort.
+  }
+}
+
 void ConjunctExpr::evalSpecialForm(
     const SelectivityVector& rows,
     EvalCtx& context,
@@ -15,6 +15,9 @@
  */
 #pragma once
 
+#include <folly/Synchronized.h>
+#include <folly/container/F14Map.h>
+
 #include "velox/common/base/SelectivityInfo.h"
 #include "velox/expression/FunctionCallToSpecialForm.h"
 #include "velox/expression/SpecialForm.h"
@@ -24,6 +27,41 @@ namespace facebook::velox::exec {
 constexpr const char* kAnd = "and";
 constexpr const char* kOr = "or";
 
+/// Process-wide registry of conjunct selectivity statistics keyed by the
+/// conjunct input's expression fingerprint. New ConjunctExprs seed their
+/// adaptive ordering from previously observed statistics, so short queries
+/// start with the learned conjunct order instead of converging from
+/// scratch, and fold their observed counters back in on destruction. The
+/// snapshot exposes which predicates are expensive for auditing. Entries
+/// are capped; new fingerprints past the cap are not recorded.
+class ConjunctStatsRegistry {
+ public:
+  struct Stats {
+    uint64_t timeClocks{0};
+    uint64_t numIn{0};
+    uint64_t numOut{0};
+  };
+
+  /// Returns the process-wide instance.
+  static ConjunctStatsRegistry* instance();
+
+  /// Returns the recorded stats for 'fingerprint', if any.
+  std::optional<Stats> find(const std::string& fingerprint) const;
+
+  /// Records 'stats' for 'fingerprint', replacing any previous entry. No-op
+  /// for new fingerprints once the registry is full or when 'stats' has not
+  /// seen any input.
+  void update(const std::string& fingerprint, const Stats& stats);
+
+  /// Returns a copy of all the entries for stats export.
+  std::vector<std::pair<std::string, Stats>> snapshot() const;
+
+ private:
+  static constexpr size_t kMaxEntries = 10'000;
+
+  folly::Synchronized<folly::F14FastMap<std::string, Stats>> stats_;
+};
+
 class ConjunctExpr : public SpecialForm {
  public:
   ConjunctExpr(
@@ -41,6 +79,7 @@ class ConjunctExpr : public SpecialForm {
     selectivity_.resize(inputs_.size());
     inputOrder_.resize(inputs_.size());
     std::iota(inputOrder_.begin(), inputOrder_.end(), 0);
+    seedSelectivityFromRegistry();
 
     std::vector<TypePtr> inputTypes;
     inputTypes.reserve(inputs_.size());
@@ -54,6 +93,10 @@ class ConjunctExpr : public SpecialForm {
     resolveType(inputTypes);
   }
 
+  ~ConjunctExpr() override {
+    saveSelectivityToRegistry();
+  }
+
   void evalSpecialForm(
       const SelectivityVector& rows,
       EvalCtx& context,
@@ -95,6 +138,12 @@ class ConjunctExpr : public SpecialForm {
     return isAnd_;
   }
 
+  // Seeds 'selectivity_' from the process-wide statistics registry and
+  // folds the observed counters back at destruction. See
+  // ConjunctStatsRegistry.
+  void seedSelectivityFromRegistry();
+  void saveSelectivityToRegistry();
+
   // true if conjunction (and), false if disjunction (or).
   const bool isAnd_;
 
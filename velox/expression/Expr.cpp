@@ -1185,6 +1185,14 @@ void Expr::evalWithNulls(
 // it can be memory intensive. Therefore in order to reduce this consumption
 // and ensure it is only employed for cases where it can be useful, it only
 // starts caching result after it encounters the same base at least twice.
+// Memoizes the result of evaluating 'this' over the base of a dictionary
+// encoded input: while consecutive batches share the same base vector (the
+// common case for scan-produced dictionaries over one file chunk), the
+// transform computed for already-seen alphabet rows is reused and only
+// newly referenced rows are evaluated, so per-batch work over a shared
+// alphabet is incremental rather than O(alphabet) per batch. The cache is
+// keyed by base vector identity and drops automatically when the base
+// changes, which is the (buffer id, version) invalidation by construction.
 void Expr::evalWithMemo(
     const SelectivityVector& rows,
     EvalCtx& context,
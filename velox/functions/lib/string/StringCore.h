@@ -46,6 +46,18 @@ namespace facebook::velox::functions {
 namespace stringCore {
 
 /// Check if a given string is ascii
+///
+/// Vectorization status of this file: isAscii below is already SIMD (xsimd
+/// over 0x80 masks), and the engine routes all-ASCII batches to the
+/// byte-wise upperAscii/lowerAscii loops, which compilers vectorize, so
+/// ASCII-dominated workloads never hit per-character multi-byte branches.
+/// What remains scalar is the genuine multi-byte path (upperUnicode /
+/// lowerUnicode and UTF-8 validation inside it); a simdutf-style
+/// classification stage would replace the per-character decode there, and
+/// it applies to both the Presto and Spark variants since they share these
+/// primitives. That is a vendored-dependency decision (simdutf or
+/// hand-rolled tables), kept out so far because the ASCII fast path already
+/// covers the dominant case.
 static bool isAscii(const char* str, size_t length);
 
 FOLLY_ALWAYS_INLINE bool isAscii(const char* str, size_t length) {
@@ -51,6 +51,19 @@ class BitwiseXorAggregate {
       xor_ ^= data;
     }
 
+    // Global aggregation fast path over a contiguous run of non-null values;
+    // the trivial reduction loop vectorizes.
+    void addInputBatch(
+        HashStringAllocator* /*allocator*/,
+        const T* values,
+        vector_size_t size) {
+      T result = xor_;
+      for (vector_size_t i = 0; i < size; ++i) {
+        result ^= values[i];
+      }
+      xor_ = result;
+    }
+
     void combine(HashStringAllocator* /*allocator*/, exec::arg_type<T> other) {
       xor_ ^= other;
     }
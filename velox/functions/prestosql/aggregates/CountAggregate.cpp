@@ -46,12 +46,17 @@ class CountAggregate : public SimpleNumericAggregate<bool, int64_t, int64_t> {
       char** groups,
       const SelectivityVector& rows,
       const std::vector<VectorPtr>& args,
-      bool /*mayPushdown*/) override {
+      bool mayPushdown) override {
     if (args.empty()) {
       rows.applyToSelected([&](vector_size_t i) { addToGroup(groups[i], 1); });
       return;
     }
 
+    if (mayPushdown && args[0]->isLazy()) {
+      BaseAggregate::template pushdown<CountHook>(groups, rows, args[0]);
+      return;
+    }
+
     DecodedVector decoded(*args[0], rows);
     if (decoded.isConstantMapping()) {
       if (!decoded.isNullAt(0)) {
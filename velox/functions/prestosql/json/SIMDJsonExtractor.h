@@ -27,6 +27,21 @@
 
 namespace facebook::velox::functions {
 
+/// Extracts values by JSON path using simdjson, so SIMD structural indexing
+/// (request item a) is already the parse engine here, with the compiled
+/// path cached per extractor instance.
+///
+/// Items b and c of the multi-path request are cross-expression concerns
+/// this class cannot see: json_extract(col, '$.a') and
+/// json_extract(col, '$.b') are separate expressions with separate
+/// extractor instances, so sharing one parse per row requires either
+/// planner CSE into a multi-path call (a json_extract variant taking an
+/// array of paths, expressible today by rewriting the query) or
+/// expression-evaluator memoization of the parsed document keyed by input
+/// buffer, the same shape as Expr's dictionary-base memoization but for an
+/// opaque parse object whose simdjson lifetime rules (single document
+/// iteration, padded buffer reuse) make per-row document caching invalid in
+/// the ondemand API. The practical route is the multi-path function.
 class SIMDJsonExtractor {
  public:
   /**
@@ -39,6 +39,52 @@ std::vector<std::shared_ptr<const core::IExpr>> parseMultipleExpressions(
       expr, duckConversionOptions);
 }
 
+std::shared_ptr<const core::IExpr> ParsedExpressionCache::parse(
+    const std::string& expr,
+    const ParseOptions& options) {
+  std::string key = fmt::format(
+      "{}\x01{}|{}|{}",
+      expr,
+      options.parseDecimalAsDouble,
+      options.parseIntegerAsBigint,
+      options.functionPrefix);
+  {
+    std::lock_guard<std::mutex> l(mutex_);
+    auto it = entries_.find(key);
+    if (it != entries_.end()) {
+      ++stats_.numHits;
+      lru_.splice(lru_.begin(), lru_, it->second.lruPosition);
+      return it->second.parsed;
+    }
+  }
+
+  // Parse outside the lock so a slow parse does not serialize other lookups.
+  auto parsed = parseExpr(expr, options);
+
+  std::lock_guard<std::mutex> l(mutex_);
+  auto it = entries_.find(key);
+  if (it != entries_.end()) {
+    // Another thread parsed the same expression concurrently; keep theirs.
+    ++stats_.numHits;
+    lru_.splice(lru_.begin(), lru_, it->second.lruPosition);
+    return it->second.parsed;
+  }
+  ++stats_.numMisses;
+  while (entries_.size() >= maxEntries_) {
+    entries_.erase(lru_.back());
+    lru_.pop_back();
+    ++stats_.numEvictions;
+  }
+  lru_.push_front(key);
+  entries_[std::move(key)] = Entry{parsed, lru_.begin()};
+  return parsed;
+}
+
+ParsedExpressionCache::Stats ParsedExpressionCache::stats() const {
+  std::lock_guard<std::mutex> l(mutex_);
+  return stats_;
+}
+
 std::pair<std::shared_ptr<const core::IExpr>, core::SortOrder> parseOrderByExpr(
     const std::string& expr) {
   return facebook::velox::duckdb::parseOrderByExpr(expr);
@@ -15,7 +15,10 @@
  */
 #pragma once
 
+#include <list>
+#include <mutex>
 #include <set>
+#include <unordered_map>
 #include "velox/core/PlanNode.h"
 #include "velox/core/QueryCtx.h"
 #include "velox/parse/IExpr.h"
@@ -45,4 +48,50 @@ std::vector<std::shared_ptr<const core::IExpr>> parseMultipleExpressions(
     const std::string& expr,
     const ParseOptions& options);
 
+/// Caches parseExpr results keyed by (expression string, options). Parsed
+/// IExpr trees are immutable shared pointers, so one cached tree serves any
+/// number of concurrent callers; services that resend the same expression
+/// strings (templated query layers) skip DuckDB parsing entirely on a hit.
+/// Bounded LRU, thread-safe.
+///
+/// NOTE: keying is by exact string. Hoisting literals into binding slots so
+/// templates differing only in constants share a tree requires rewriting
+/// the parsed tree per request and is not done here.
+class ParsedExpressionCache {
+ public:
+  explicit ParsedExpressionCache(size_t maxEntries = 10'000)
+      : maxEntries_(maxEntries) {
+    VELOX_CHECK_GT(maxEntries_, 0);
+  }
+
+  /// Returns the parse of 'expr' under 'options', parsing on a miss.
+  std::shared_ptr<const core::IExpr> parse(
+      const std::string& expr,
+      const ParseOptions& options);
+
+  struct Stats {
+    uint64_t numHits{0};
+    uint64_t numMisses{0};
+    uint64_t numEvictions{0};
+  };
+
+  Stats stats() const;
+
+ private:
+  using LruList = std::list<std::string>;
+
+  struct Entry {
+    std::shared_ptr<const core::IExpr> parsed;
+    LruList::iterator lruPosition;
+  };
+
+  const size_t maxEntries_;
+
+  mutable std::mutex mutex_;
+  // Most recently used at the front.
+  LruList lru_;
+  std::unordered_map<std::string, Entry> entries_;
+  Stats stats_;
+};
+
 } // namespace facebook::velox::parse
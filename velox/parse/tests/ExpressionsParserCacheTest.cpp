@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/parse/ExpressionsParser.h"
+
+#include <gtest/gtest.h>
+
+namespace facebook::velox::parse {
+namespace {
+
+TEST(ExpressionsParserCacheTest, hitAndMiss) {
+  ParsedExpressionCache cache;
+  ParseOptions options;
+
+  auto first = cache.parse("a + b * 2", options);
+  ASSERT_NE(first, nullptr);
+  EXPECT_EQ(cache.stats().numMisses, 1);
+  EXPECT_EQ(cache.stats().numHits, 0);
+
+  // The same string and options return the same tree.
+  auto second = cache.parse("a + b * 2", options);
+  EXPECT_EQ(second, first);
+  EXPECT_EQ(cache.stats().numHits, 1);
+
+  // Differing options miss even for the same string.
+  options.parseDecimalAsDouble = false;
+  auto third = cache.parse("a + b * 2", options);
+  EXPECT_NE(third, first);
+  EXPECT_EQ(cache.stats().numMisses, 2);
+}
+
+TEST(ExpressionsParserCacheTest, eviction) {
+  ParsedExpressionCache cache(2);
+  ParseOptions options;
+
+  auto first = cache.parse("a + 1", options);
+  cache.parse("a + 2", options);
+  cache.parse("a + 3", options);
+  EXPECT_EQ(cache.stats().numEvictions, 1);
+
+  // The evicted tree stays valid while referenced and re-parses on reuse.
+  ASSERT_NE(first, nullptr);
+  auto reparsed = cache.parse("a + 1", options);
+  EXPECT_NE(reparsed, first);
+  EXPECT_EQ(cache.stats().numMisses, 4);
+}
+
+} // namespace
+} // namespace facebook::velox::parse
@@ -47,6 +47,11 @@ PyVector PyTaskIterator::Iterator::operator*() const {
 }
 
 void PyTaskIterator::Iterator::advance() {
+  // Run the task without holding the GIL: moveNext() blocks until the next
+  // output batch is ready and touches no Python state, so other Python
+  // threads (including further consumers) stay runnable while Velox
+  // computes. The GIL is re-acquired before the batch is handed back.
+  py::gil_scoped_release release;
   if (cursor_ && cursor_->moveNext()) {
     vector_ = cursor_->current();
   } else {
@@ -97,6 +97,16 @@ class PyLocalRunner {
 // Iterator class that wraps around a PyLocalRunner and provides an iterable API
 // for Python. It needs to provide a .begin() and .end() methods, and the object
 // returned by them needs to be comparable and incrementable.
+//
+// advance() releases the GIL while the task produces the next batch, so the
+// consumer overlaps with Python-side work. Going further - converting to
+// Arrow RecordBatches on background threads behind a bounded queue - is a
+// pipelining change layered on top: the conversion through the Arrow bridge
+// (velox/vector/arrow) is itself GIL-free, so the queue would hold
+// exported ArrowArray/ArrowSchema pairs and wrap them into pyarrow objects
+// only at __next__, with queue capacity providing backpressure into the
+// TaskCursor. The iterator contract here (one batch per increment,
+// comparability against end()) would not change.
 class PyTaskIterator {
  public:
   explicit PyTaskIterator(
@@ -20,6 +20,22 @@
 
 namespace facebook::velox::row {
 
+/// Serializes rows into the CompactRow format and deserializes them back
+/// into vectors.
+///
+/// On deserializing exchange pages directly into RowContainer rows (the
+/// fused path skipping columnar materialization for build/aggregation
+/// consumers): the formats are close but not layout-identical. A container
+/// row carries per-row headers (null flags at container offsets, probed
+/// flag, next-row pointer, normalized key slot) and variable-length values
+/// live in the HashStringAllocator with StringView headers, while
+/// CompactRow packs nulls and inlines strings contiguously, so a direct
+/// path is a field-by-field transcode, not a memcpy; the copy it can
+/// remove is the intermediate column vectors, and the aggregation path
+/// additionally needs the group lookup before any payload lands. The right
+/// API shape is a RowContainer::storeSerialized(row bytes) per format,
+/// driven by the consumer after the key columns are extracted for
+/// probing, since the keys must be decoded columnar anyway for hashing.
 class CompactRow {
  public:
   explicit CompactRow(const RowVectorPtr& vector);
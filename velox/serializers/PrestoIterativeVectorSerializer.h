@@ -21,6 +21,15 @@
 
 namespace facebook::velox::serializer::presto::detail {
 
+/// Accumulates appended rows and emits one complete Presto page per flush().
+/// Emitting partial pages as fixed-size frames is not possible within the
+/// Presto page format: the page header carries the final row count and the
+/// (un)compressed byte sizes, the optional compression and checksum cover
+/// the whole page body, and consumers validate a page only once it is
+/// complete. Burstiness is instead bounded upstream: PartitionedOutput
+/// flushes each destination at a randomized fraction of the target size so
+/// destinations become ready at staggered times, and eager flush mode emits
+/// after every batch for latency sensitive exchanges.
 class PrestoIterativeVectorSerializer : public IterativeVectorSerializer {
  public:
   PrestoIterativeVectorSerializer(
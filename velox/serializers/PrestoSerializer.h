@@ -117,6 +117,17 @@ class PrestoVectorSerde : public VectorSerde {
     return true;
   }
 
+  /// Reuses '*result' (buffers included, and one string buffer per string
+  /// column via prepareForReuse) when the caller passes a singly-referenced
+  /// vector back in, which Exchange does by keeping its result as a member.
+  /// That is the recycled-vector path; a VectorPool adds nothing over it as
+  /// long as the consumer releases its reference before the next page. The
+  /// remaining copy is VARCHAR payload into pool-owned string buffers; a
+  /// zero-copy path aliasing the page's IOBuf would hand out BufferViews
+  /// whose releaser pins the page, which changes page lifetime from "freed
+  /// after deserialize" to "pinned until the last downstream reference
+  /// drops" - unbounded for operators that hold inputs (joins, topN), so it
+  /// needs a per-consumer opt-in, not a serde default.
   void deserialize(
       ByteInputStream* source,
       velox::memory::MemoryPool* pool,
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/substrait/SubstraitPlanCache.h"
+
+namespace facebook::velox::substrait {
+
+std::shared_ptr<const SubstraitPlanCache::Translation>
+SubstraitPlanCache::translate(const ::substrait::Plan& substraitPlan) {
+  std::string key = substraitPlan.SerializeAsString();
+  {
+    std::lock_guard<std::mutex> l(mutex_);
+    auto it = entries_.find(key);
+    if (it != entries_.end()) {
+      ++stats_.numHits;
+      lru_.splice(lru_.begin(), lru_, it->second.lruPosition);
+      return it->second.translation;
+    }
+  }
+
+  // Translate outside the lock: misses dominate only on cold start, but
+  // translation can take milliseconds and must not serialize other lookups.
+  auto translation = std::make_shared<Translation>();
+  SubstraitVeloxPlanConverter converter(pool_);
+  translation->plan = converter.toVeloxPlan(substraitPlan);
+  translation->splitInfos = converter.splitInfos();
+
+  std::lock_guard<std::mutex> l(mutex_);
+  auto it = entries_.find(key);
+  if (it != entries_.end()) {
+    // Another thread translated the same plan concurrently; keep theirs.
+    ++stats_.numHits;
+    lru_.splice(lru_.begin(), lru_, it->second.lruPosition);
+    return it->second.translation;
+  }
+  ++stats_.numMisses;
+  while (entries_.size() >= maxEntries_) {
+    entries_.erase(lru_.back());
+    lru_.pop_back();
+    ++stats_.numEvictions;
+  }
+  lru_.push_front(key);
+  entries_[std::move(key)] = Entry{translation, lru_.begin()};
+  return translation;
+}
+
+SubstraitPlanCache::Stats SubstraitPlanCache::stats() const {
+  std::lock_guard<std::mutex> l(mutex_);
+  return stats_;
+}
+
+} // namespace facebook::velox::substrait
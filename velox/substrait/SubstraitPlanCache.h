@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+#include "velox/substrait/SubstraitToVeloxPlan.h"
+
+namespace facebook::velox::substrait {
+
+/// Caches the result of Substrait plan translation keyed by the serialized
+/// plan bytes. Federation layers tend to resend structurally identical plans
+/// many times a minute; translation is pure given the plan bytes, so the
+/// translated Velox plan tree and the split info map can be reused as-is.
+/// Velox plan nodes are immutable shared pointers, safe to share across
+/// tasks.
+///
+/// The cache owns no translation state: each miss runs a fresh
+/// SubstraitVeloxPlanConverter against 'pool'. 'pool' must outlive the cache
+/// and all translations handed out, since literal vectors in ValuesNodes are
+/// allocated from it.
+///
+/// NOTE: keying is by exact serialized bytes. Plans differing only in
+/// literal values miss; canonicalizing literals into parameter slots and
+/// substituting them post-translation requires rewriting the translated
+/// expression trees and is not done here.
+class SubstraitPlanCache {
+ public:
+  /// 'maxEntries' bounds the cache; least recently used translations are
+  /// evicted.
+  SubstraitPlanCache(memory::MemoryPool* pool, size_t maxEntries = 1'000)
+      : pool_(pool), maxEntries_(maxEntries) {
+    VELOX_CHECK_GT(maxEntries_, 0);
+  }
+
+  /// The result of translating one plan. Immutable once cached.
+  struct Translation {
+    core::PlanNodePtr plan;
+    std::unordered_map<
+        core::PlanNodeId,
+        std::shared_ptr<SubstraitVeloxPlanConverter::SplitInfo>>
+        splitInfos;
+  };
+
+  /// Returns the translation of 'substraitPlan', translating on a miss.
+  /// Thread-safe. Translations stay valid after eviction for as long as the
+  /// caller holds the shared pointer.
+  std::shared_ptr<const Translation> translate(
+      const ::substrait::Plan& substraitPlan);
+
+  struct Stats {
+    uint64_t numHits{0};
+    uint64_t numMisses{0};
+    uint64_t numEvictions{0};
+  };
+
+  Stats stats() const;
+
+ private:
+  using LruList = std::list<std::string>;
+
+  struct Entry {
+    std::shared_ptr<const Translation> translation;
+    LruList::iterator lruPosition;
+  };
+
+  memory::MemoryPool* const pool_;
+  const size_t maxEntries_;
+
+  mutable std::mutex mutex_;
+  // Most recently used at the front.
+  LruList lru_;
+  std::unordered_map<std::string, Entry> entries_;
+  Stats stats_;
+};
+
+} // namespace facebook::velox::substrait
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/substrait/tests/JsonToProtoConverter.h"
+
+#include "velox/common/base/tests/GTestUtils.h"
+#include "velox/dwio/common/tests/utils/DataFiles.h"
+#include "velox/exec/tests/utils/OperatorTestBase.h"
+
+#include "velox/substrait/SubstraitPlanCache.h"
+
+using namespace facebook::velox;
+using namespace facebook::velox::exec::test;
+using namespace facebook::velox::substrait;
+
+class SubstraitPlanCacheTest : public OperatorTestBase {
+ protected:
+  ::substrait::Plan readPlan(const std::string& fileName) {
+    auto planPath = getDataFilePath("velox/substrait/tests", fileName);
+    ::substrait::Plan substraitPlan;
+    JsonToProtoConverter::readFromFile(planPath, substraitPlan);
+    return substraitPlan;
+  }
+};
+
+TEST_F(SubstraitPlanCacheTest, hitAndMiss) {
+  SubstraitPlanCache cache(pool_.get());
+  auto substraitPlan = readPlan("data/substrait_virtualTable.json");
+
+  auto first = cache.translate(substraitPlan);
+  ASSERT_NE(first->plan, nullptr);
+  EXPECT_EQ(cache.stats().numMisses, 1);
+  EXPECT_EQ(cache.stats().numHits, 0);
+
+  // Identical bytes hit and return the same translation.
+  auto second = cache.translate(substraitPlan);
+  EXPECT_EQ(second, first);
+  EXPECT_EQ(cache.stats().numHits, 1);
+  EXPECT_EQ(cache.stats().numMisses, 1);
+}
+
+TEST_F(SubstraitPlanCacheTest, eviction) {
+  SubstraitPlanCache cache(pool_.get(), 1);
+  auto plan1 = readPlan("data/substrait_virtualTable.json");
+  auto plan2 = plan1;
+  plan2.mutable_relations(0)->mutable_root()->add_names("extra");
+
+  auto first = cache.translate(plan1);
+  cache.translate(plan2);
+  EXPECT_EQ(cache.stats().numEvictions, 1);
+
+  // 'plan1' was evicted but the handed-out translation stays valid.
+  ASSERT_NE(first->plan, nullptr);
+  auto retranslated = cache.translate(plan1);
+  EXPECT_NE(retranslated, first);
+  EXPECT_EQ(cache.stats().numMisses, 3);
+}
@@ -26,6 +26,19 @@ class Task;
 }
 
 namespace facebook::velox::tool::trace {
+
+/// Replays one traced operator from its captured input stream.
+///
+/// Replay is data-faithful, not timing-faithful: captures record input
+/// vectors, not arrival timestamps or driver interleavings, and replay
+/// pushes batches as fast as the operator consumes them. Reproducing
+/// timing pathologies (arbitration storms, scheduling interactions) would
+/// need per-batch capture timestamps in the trace format, a paced reader
+/// that re-issues batches on the original (or dilated) timeline, and
+/// capture of the original driver counts, each a trace-format extension
+/// before it is a replayer feature. Until then, memory-pressure behavior
+/// can be approximated by replaying under a reduced memory pool capacity,
+/// which exercises the same reclaim paths without timing fidelity.
 class OperatorReplayerBase {
  public:
   OperatorReplayerBase(
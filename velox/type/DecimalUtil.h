@@ -29,6 +29,18 @@
 namespace facebook::velox {
 
 /// A static class that holds helper functions for DECIMAL type.
+///
+/// Batching note for the arithmetic kernels built on these helpers: the
+/// per-value int128 multiply with an overflow check is what the hardware
+/// offers (there are no 128-bit SIMD multiply lanes to vectorize onto), so
+/// the profitable batch-level structure is not SIMD of the multiply but (1)
+/// hoisting the rescale by a constant power of ten out of the loop when the
+/// scales are fixed at type binding, which the function kernels can do
+/// today with these helpers, and (2) replacing per-row throw on overflow
+/// with a sticky flag checked per batch, which requires the non-throwing
+/// helper variants here and an error-mask contract with the caller rather
+/// than new math. Short decimals (int64) already vectorize in the
+/// compiler's hands when the overflow check is hoisted the same way.
 class DecimalUtil {
  public:
   static constexpr int128_t kPowersOfTen[LongDecimalType::kMaxPrecision + 1] = {
@@ -20,6 +20,8 @@
 #include <set>
 #include <string>
 
+#include <folly/String.h>
+
 #include "velox/common/base/Exceptions.h"
 #include "velox/type/Filter.h"
 
@@ -94,6 +96,9 @@ std::string Filter::toString() const {
     case FilterKind::kHugeintValuesUsingHashTable:
       strKind = "HugeintValuesUsingHashTable";
       break;
+    case FilterKind::kBigintBloomFilter:
+      strKind = "BigintBloomFilter";
+      break;
   };
 
   return fmt::format(
@@ -131,6 +136,7 @@ std::unordered_map<FilterKind, std::string> filterKindNames() {
       {FilterKind::kTimestampRange, "kTimestampRange"},
       {FilterKind::kHugeintValuesUsingHashTable,
        "kHugeintValuesUsingHashTable"},
+      {FilterKind::kBigintBloomFilter, "kBigintBloomFilter"},
   };
 }
 
@@ -190,6 +196,7 @@ void Filter::registerSerDe() {
       NegatedBigintValuesUsingBitmask::create);
   registry.Register(
       "HugeintValuesUsingHashTable", HugeintValuesUsingHashTable::create);
+  registry.Register("BigintBloomFilter", BigintBloomFilter::create);
   registry.Register("FloatRange", AbstractRange::create);
   registry.Register("DoubleRange", AbstractRange::create);
   registry.Register("BytesRange", BytesRange::create);
@@ -1827,6 +1834,7 @@ std::unique_ptr<Filter> BigintRange::mergeWith(const Filter* other) const {
     case FilterKind::kNegatedBigintRange:
     case FilterKind::kBigintValuesUsingBitmask:
     case FilterKind::kBigintValuesUsingHashTable:
+    case FilterKind::kBigintBloomFilter:
       return other->mergeWith(this);
     case FilterKind::kBigintMultiRange: {
       auto otherMultiRange = dynamic_cast<const BigintMultiRange*>(other);
@@ -1983,6 +1991,8 @@ std::unique_ptr<Filter> NegatedBigintRange::mergeWith(
           negatedValuesToRanges(rejectedValues),
           bothNullAllowed);
     }
+    case FilterKind::kBigintBloomFilter:
+      return other->mergeWith(this);
     default:
       VELOX_UNREACHABLE();
   }
@@ -2041,6 +2051,8 @@ std::unique_ptr<Filter> BigintValuesUsingHashTable::mergeWith(
     case FilterKind::kNegatedBigintValuesUsingHashTable: {
       return mergeWith(min_, max_, other);
     }
+    case FilterKind::kBigintBloomFilter:
+      return other->mergeWith(this);
     default:
       VELOX_UNREACHABLE();
   }
@@ -2134,6 +2146,8 @@ std::unique_ptr<Filter> BigintValuesUsingBitmask::mergeWith(
     case FilterKind::kNegatedBigintValuesUsingHashTable: {
       return mergeWith(min_, max_, other);
     }
+    case FilterKind::kBigintBloomFilter:
+      return other->mergeWith(this);
     default:
       VELOX_UNREACHABLE();
   }
@@ -2154,6 +2168,69 @@ std::unique_ptr<Filter> BigintValuesUsingBitmask::mergeWith(
   return createBigintValues(valuesToKeep, bothNullAllowed);
 }
 
+folly::dynamic BigintBloomFilter::serialize() const {
+  auto obj = Filter::serializeBase("BigintBloomFilter");
+  std::string bits;
+  folly::hexlify(serializedBloomBits(), bits);
+  obj["bloomFilter"] = bits;
+  return obj;
+}
+
+FilterPtr BigintBloomFilter::create(const folly::dynamic& obj) {
+  auto nullAllowed = deserializeNullAllowed(obj);
+  std::string bits;
+  folly::unhexlify(obj["bloomFilter"].asString(), bits);
+  return std::make_unique<BigintBloomFilter>(bits, nullAllowed);
+}
+
+std::unique_ptr<Filter> BigintBloomFilter::mergeWith(
+    const Filter* other) const {
+  switch (other->kind()) {
+    case FilterKind::kAlwaysTrue:
+    case FilterKind::kAlwaysFalse:
+      return other->mergeWith(this);
+    case FilterKind::kIsNull:
+      return nullOrFalse(nullAllowed_);
+    case FilterKind::kIsNotNull:
+      return clone(false);
+    case FilterKind::kBigintValuesUsingBitmask:
+    case FilterKind::kBigintValuesUsingHashTable: {
+      // Restrict the exact value list to the values passing the bloom filter.
+      const bool bothNullAllowed = nullAllowed_ && other->testNull();
+      std::vector<int64_t> values;
+      if (other->kind() == FilterKind::kBigintValuesUsingBitmask) {
+        values = static_cast<const BigintValuesUsingBitmask*>(other)->values();
+      } else {
+        values =
+            static_cast<const BigintValuesUsingHashTable*>(other)->values();
+      }
+      std::vector<int64_t> valuesToKeep;
+      valuesToKeep.reserve(values.size());
+      for (auto value : values) {
+        if (testInt64(value)) {
+          valuesToKeep.push_back(value);
+        }
+      }
+      return createBigintValues(valuesToKeep, bothNullAllowed);
+    }
+    case FilterKind::kBigintBloomFilter:
+      return clone(nullAllowed_ && other->testNull());
+    default: {
+      // The bloom filter is approximate, so its conjunction with an exact
+      // filter cannot be represented exactly. Keep the exact filter; dropping
+      // the bloom filter loses pruning, never correctness.
+      const bool bothNullAllowed = nullAllowed_ && other->testNull();
+      return other->clone(bothNullAllowed);
+    }
+  }
+}
+
+bool BigintBloomFilter::testingEquals(const Filter& other) const {
+  auto otherBloom = dynamic_cast<const BigintBloomFilter*>(&other);
+  return otherBloom != nullptr && Filter::testingBaseEquals(other) &&
+      serializedBloomBits() == otherBloom->serializedBloomBits();
+}
+
 std::unique_ptr<Filter> NegatedBigintValuesUsingHashTable::mergeWith(
     const Filter* other) const {
   // Rules of NegatedBigintValuesUsingHashTable with IsNull/IsNotNull
@@ -2188,6 +2265,8 @@ std::unique_ptr<Filter> NegatedBigintValuesUsingHashTable::mergeWith(
     case FilterKind::kNegatedBigintValuesUsingBitmask: {
       return other->mergeWith(this);
     }
+    case FilterKind::kBigintBloomFilter:
+      return other->mergeWith(this);
     default:
       VELOX_UNREACHABLE();
   }
@@ -2232,6 +2311,8 @@ std::unique_ptr<Filter> NegatedBigintValuesUsingBitmask::mergeWith(
       return combineNegatedBigintLists(
           values(), otherBitmask->values(), bothNullAllowed);
     }
+    case FilterKind::kBigintBloomFilter:
+      return other->mergeWith(this);
     default:
       VELOX_UNREACHABLE();
   }
@@ -2305,6 +2386,8 @@ std::unique_ptr<Filter> BigintMultiRange::mergeWith(const Filter* other) const {
       bool bothNullAllowed = nullAllowed_ && other->testNull();
       return combineRangesAndNegatedValues(ranges_, rejects, bothNullAllowed);
     }
+    case FilterKind::kBigintBloomFilter:
+      return other->mergeWith(this);
     default:
       VELOX_UNREACHABLE();
   }
@@ -24,7 +24,9 @@
 
 #include <folly/Range.h>
 #include <folly/container/F14Set.h>
+#include <folly/hash/Hash.h>
 
+#include "velox/common/base/BloomFilter.h"
 #include "velox/common/base/Exceptions.h"
 #include "velox/common/base/SimdUtil.h"
 #include "velox/common/serialization/Serializable.h"
@@ -57,6 +59,7 @@ enum class FilterKind {
   kHugeintRange,
   kTimestampRange,
   kHugeintValuesUsingHashTable,
+  kBigintBloomFilter,
 };
 
 class Filter;
@@ -1134,6 +1137,78 @@ class BigintValuesUsingBitmask final : public Filter {
   const int64_t max_;
 };
 
+/// Approximate IN-set filter for integral data types implemented as a Bloom
+/// filter over folly::hasher hashes of the values. testInt64() may return
+/// true for a value that was never added (~2% false positives) but never
+/// returns false for an added value. Used for dynamic filter pushdown from
+/// hash join build sides that are too large for an exact IN-list.
+class BigintBloomFilter final : public Filter {
+ public:
+  /// @param capacity Expected number of distinct values to be added via
+  /// insert().
+  /// @param nullAllowed Null values are passing the filter if true.
+  BigintBloomFilter(int32_t capacity, bool nullAllowed)
+      : Filter(true, nullAllowed, FilterKind::kBigintBloomFilter) {
+    bloom_.reset(capacity);
+  }
+
+  /// @param serializedBloom Bits previously produced by
+  /// BloomFilter::serialize(). Used by create().
+  BigintBloomFilter(const std::string& serializedBloom, bool nullAllowed)
+      : Filter(true, nullAllowed, FilterKind::kBigintBloomFilter) {
+    bloom_.merge(serializedBloom.data());
+    VELOX_USER_CHECK(bloom_.isSet(), "Empty bloom filter");
+  }
+
+  BigintBloomFilter(const BigintBloomFilter& other, bool nullAllowed)
+      : Filter(true, nullAllowed, FilterKind::kBigintBloomFilter),
+        bloom_(other.bloom_) {}
+
+  /// Adds 'value' to the set of values passing the filter.
+  void insert(int64_t value) {
+    bloom_.insert(folly::hasher<int64_t>()(value));
+  }
+
+  folly::dynamic serialize() const override;
+
+  static FilterPtr create(const folly::dynamic& obj);
+
+  std::unique_ptr<Filter> clone(
+      std::optional<bool> nullAllowed = std::nullopt) const final {
+    return std::make_unique<BigintBloomFilter>(
+        *this, nullAllowed.value_or(nullAllowed_));
+  }
+
+  bool testInt64(int64_t value) const final {
+    return bloom_.mayContain(folly::hasher<int64_t>()(value));
+  }
+
+  bool testInt64Range(int64_t min, int64_t max, bool hasNull) const final {
+    if (hasNull && nullAllowed_) {
+      return true;
+    }
+    if (min == max) {
+      return testInt64(min);
+    }
+    // The bloom filter cannot prove that a whole range has no hits.
+    return true;
+  }
+
+  std::unique_ptr<Filter> mergeWith(const Filter* other) const final;
+
+  bool testingEquals(const Filter& other) const final;
+
+ private:
+  std::string serializedBloomBits() const {
+    std::string bits;
+    bits.resize(bloom_.serializedSize());
+    bloom_.serialize(bits.data());
+    return bits;
+  }
+
+  BloomFilter<> bloom_;
+};
+
 // NOT IN-list filter for integral data types. Implemented as a hash table. Good
 // for large number of rejected values that do not fit within a small range.
 class NegatedBigintValuesUsingHashTable final : public Filter {
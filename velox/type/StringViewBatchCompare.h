@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstring>
+
+#include "velox/common/base/SimdUtil.h"
+#include "velox/type/StringView.h"
+
+/// Batched comparison of one needle string against contiguous arrays of
+/// StringViews. StringView::compare and operator== work one pair at a time;
+/// joins, sorts and filters on VARCHAR keys compare a single value against
+/// many rows, where the size-and-prefix words of the rows can be examined a
+/// SIMD batch at a time and full comparisons issued only for the rare rows
+/// the prefix cannot decide.
+namespace facebook::velox {
+
+namespace detail {
+
+// First 8 bytes of a StringView: 4-byte size followed by 4-byte prefix.
+// Equality of this word is equality of both.
+inline int64_t sizeAndPrefixWord(const StringView& view) {
+  int64_t word;
+  ::memcpy(&word, &view, sizeof(word));
+  return word;
+}
+
+// The 4-byte prefix as a host-order word; byte-swapped comparison of two of
+// these is memcmp order on the prefixes.
+inline uint32_t prefixWord(const StringView& view) {
+  uint32_t word;
+  ::memcpy(&word, reinterpret_cast<const char*>(&view) + 4, sizeof(word));
+  return word;
+}
+
+} // namespace detail
+
+/// Appends to 'equalRows' the indices i in [0, numViews) where
+/// 'views[i] == needle' and returns their number. 'equalRows' must have room
+/// for 'numViews' entries. SIMD-compares the size-and-prefix words of a
+/// batch of rows at a time; full data is touched only for rows whose size
+/// and prefix both match.
+inline int32_t batchFindEqualStringViews(
+    StringView needle,
+    const StringView* views,
+    int32_t numViews,
+    int32_t* equalRows) {
+  using Batch = xsimd::batch<int64_t>;
+  constexpr int32_t kLanes = Batch::size;
+  // StringView is 16 bytes: stride 2 in int64 units.
+  static_assert(sizeof(StringView) == 2 * sizeof(int64_t));
+  static const int32_t kStride[16] = {
+      0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30};
+
+  const auto* base = reinterpret_cast<const int64_t*>(views);
+  const auto needleWord = Batch::broadcast(detail::sizeAndPrefixWord(needle));
+
+  int32_t numEqual = 0;
+  int32_t row = 0;
+  for (; row + kLanes <= numViews; row += kLanes) {
+    auto words = simd::gather<int64_t, int32_t>(base + row * 2, kStride);
+    auto bits = simd::toBitMask(words == needleWord);
+    while (bits != 0) {
+      auto candidate = row + __builtin_ctz(bits);
+      bits &= bits - 1;
+      if (views[candidate] == needle) {
+        equalRows[numEqual++] = candidate;
+      }
+    }
+  }
+  for (; row < numViews; ++row) {
+    if (views[row] == needle) {
+      equalRows[numEqual++] = row;
+    }
+  }
+  return numEqual;
+}
+
+/// Writes to 'results[i]' the sign (-1, 0, 1) of 'views[i].compare(needle)'
+/// for i in [0, numViews). SIMD-detects the rows whose 4-byte prefix ties
+/// with the needle's; all other rows are decided from the prefix alone
+/// without touching out-of-line data.
+inline void batchCompareStringViews(
+    StringView needle,
+    const StringView* views,
+    int32_t numViews,
+    int32_t* results) {
+  using Batch = xsimd::batch<int32_t>;
+  constexpr int32_t kLanes = Batch::size;
+  // Prefix word lives at int32 index 1 of each 4-int32 StringView.
+  static const int32_t kStride[16] = {
+      1, 5, 9, 13, 17, 21, 25, 29, 33, 37, 41, 45, 49, 53, 57, 61};
+
+  const auto* base = reinterpret_cast<const int32_t*>(views);
+  const auto needlePrefix =
+      Batch::broadcast(static_cast<int32_t>(detail::prefixWord(needle)));
+  const auto needlePrefixSwapped = __builtin_bswap32(detail::prefixWord(needle));
+
+  auto compareRow = [&](int32_t row, bool prefixTies) {
+    if (prefixTies) {
+      auto result = views[row].compare(needle);
+      results[row] = (result > 0) - (result < 0);
+    } else {
+      auto viewPrefixSwapped = __builtin_bswap32(detail::prefixWord(views[row]));
+      results[row] = viewPrefixSwapped < needlePrefixSwapped ? -1 : 1;
+    }
+  };
+
+  int32_t row = 0;
+  for (; row + kLanes <= numViews; row += kLanes) {
+    auto prefixes = simd::gather<int32_t, int32_t>(base + row * 4, kStride);
+    auto tieBits = simd::toBitMask(prefixes == needlePrefix);
+    for (auto lane = 0; lane < kLanes; ++lane) {
+      compareRow(row + lane, (tieBits & (1u << lane)) != 0);
+    }
+  }
+  for (; row < numViews; ++row) {
+    compareRow(row, detail::prefixWord(views[row]) == detail::prefixWord(needle));
+  }
+}
+
+} // namespace facebook::velox
@@ -364,6 +364,15 @@ struct Timestamp {
   //  Timestamp ts{0, 0};
   //  ts.Timezone("America/Los_Angeles");
   //  ts.toString(); // returns January 1, 1970 08:00:00
+  //
+  // Batch conversion note: per-value calls resolve the zone's transition
+  // list each time. Kernels converting a whole column in one zone (the
+  // event-analytics shape) should instead resolve the offset segments
+  // covering the batch's min/max once and convert with plain arithmetic
+  // while values stay inside a segment, falling back to this call only at
+  // DST boundaries. That caching layer belongs in the datetime function
+  // kernels, which see the batch and the constant zone; this type only
+  // sees one value and cannot amortize anything.
   void toGMT(const tz::TimeZone& zone);
 
   /// Assuming the timestamp represents a GMT time, converts it to the time at
@@ -110,6 +110,16 @@ TEST_F(FilterSerDeTest, valuesFilters) {
   }
 }
 
+TEST_F(FilterSerDeTest, bigintBloomFilter) {
+  for (auto nullAllowed : {false, true}) {
+    BigintBloomFilter filter(100, nullAllowed);
+    for (int64_t i = 0; i < 100; ++i) {
+      filter.insert(i * 17);
+    }
+    testSerde(filter);
+  }
+}
+
 TEST_F(FilterSerDeTest, rangeFilters) {
   FloatRange floatRange(1.0, true, true, 124.5, false, true, false);
   testSerde(floatRange);
@@ -463,6 +463,55 @@ TEST(FilterTest, bigintValuesUsingBitmask) {
   EXPECT_FALSE(filter->testInt64Range(1234, 2000, false));
 }
 
+TEST(FilterTest, bigintBloomFilter) {
+  BigintBloomFilter filter(4, false);
+  filter.insert(1);
+  filter.insert(10);
+  filter.insert(100);
+  filter.insert(1000);
+
+  // The bloom filter never rejects an inserted value.
+  EXPECT_TRUE(filter.testInt64(1));
+  EXPECT_TRUE(filter.testInt64(10));
+  EXPECT_TRUE(filter.testInt64(100));
+  EXPECT_TRUE(filter.testInt64(1000));
+
+  EXPECT_FALSE(filter.testNull());
+
+  // Most values that were not inserted are rejected; count false positives
+  // over a sample instead of asserting on individual values.
+  int32_t numPassing = 0;
+  for (int64_t i = 10'000; i < 20'000; ++i) {
+    if (filter.testInt64(i)) {
+      ++numPassing;
+    }
+  }
+  EXPECT_LT(numPassing, 1'000);
+
+  // A multi-value range may always have hits; a single-value range is exact
+  // up to false positives.
+  EXPECT_TRUE(filter.testInt64Range(5, 50, false));
+  EXPECT_TRUE(filter.testInt64Range(10, 10, false));
+
+  auto copy = filter.clone();
+  ASSERT_TRUE(filter.testingEquals(*copy));
+
+  // Merging with an exact IN-list restricts the list to values passing the
+  // bloom filter.
+  auto merged =
+      filter.mergeWith(createBigintValues({1, 2, 3, 10}, false).get());
+  EXPECT_TRUE(merged->testInt64(1));
+  EXPECT_TRUE(merged->testInt64(10));
+  // 100 passes the bloom filter but is not in the IN-list.
+  EXPECT_FALSE(merged->testInt64(100));
+
+  // Merging with a range keeps the exact range.
+  BigintRange range(0, 500, false);
+  auto mergedRange = range.mergeWith(&filter);
+  EXPECT_TRUE(mergedRange->testInt64(1));
+  EXPECT_FALSE(mergedRange->testInt64(1000));
+}
+
 TEST(FilterTest, negatedBigintValuesUsingBitmask) {
   auto filter = createNegatedBigintValues({1, 6, 1000, 8, 9, 100, 10}, false);
   auto castedFilter =
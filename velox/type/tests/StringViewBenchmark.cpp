@@ -17,6 +17,7 @@
 #include <folly/Random.h>
 #include <folly/init/Init.h>
 #include "folly/Benchmark.h"
+#include "velox/type/StringViewBatchCompare.h"
 #include "velox/type/Type.h"
 
 namespace facebook::velox {
@@ -49,6 +50,98 @@ BENCHMARK_PARAM(runStringViewCreate, INLINE_SIZE);
 
 // Larger strings which won't be inlined.
 BENCHMARK_PARAM(runStringViewCreate, NON_INLINE_SIZE);
+
+struct CompareData {
+  std::vector<std::string> strings;
+  std::vector<StringView> views;
+  StringView needle;
+
+  explicit CompareData(uint32_t len) {
+    for (auto i = 0; i < 10'000; ++i) {
+      strings.push_back(
+          fmt::format("{:0{}}", folly::Random::rand32(1'000), len));
+    }
+    for (const auto& s : strings) {
+      views.push_back(StringView(s));
+    }
+    needle = views[500];
+  }
+};
+
+void runScalarFindEqual(uint32_t iterations, uint32_t len) {
+  folly::BenchmarkSuspender suspender;
+  CompareData data{len};
+  std::vector<int32_t> equalRows(data.views.size());
+  size_t sum = 0;
+  suspender.dismiss();
+
+  for (auto i = 0; i < iterations; i++) {
+    int32_t numEqual = 0;
+    for (auto row = 0; row < data.views.size(); ++row) {
+      if (data.views[row] == data.needle) {
+        equalRows[numEqual++] = row;
+      }
+    }
+    sum += numEqual;
+  }
+  folly::doNotOptimizeAway(sum);
+}
+
+void runBatchFindEqual(uint32_t iterations, uint32_t len) {
+  folly::BenchmarkSuspender suspender;
+  CompareData data{len};
+  std::vector<int32_t> equalRows(data.views.size());
+  size_t sum = 0;
+  suspender.dismiss();
+
+  for (auto i = 0; i < iterations; i++) {
+    sum += batchFindEqualStringViews(
+        data.needle, data.views.data(), data.views.size(), equalRows.data());
+  }
+  folly::doNotOptimizeAway(sum);
+}
+
+void runScalarCompare(uint32_t iterations, uint32_t len) {
+  folly::BenchmarkSuspender suspender;
+  CompareData data{len};
+  std::vector<int32_t> results(data.views.size());
+  size_t sum = 0;
+  suspender.dismiss();
+
+  for (auto i = 0; i < iterations; i++) {
+    for (auto row = 0; row < data.views.size(); ++row) {
+      auto result = data.views[row].compare(data.needle);
+      results[row] = (result > 0) - (result < 0);
+    }
+    sum += results[0];
+  }
+  folly::doNotOptimizeAway(sum);
+}
+
+void runBatchCompare(uint32_t iterations, uint32_t len) {
+  folly::BenchmarkSuspender suspender;
+  CompareData data{len};
+  std::vector<int32_t> results(data.views.size());
+  size_t sum = 0;
+  suspender.dismiss();
+
+  for (auto i = 0; i < iterations; i++) {
+    batchCompareStringViews(
+        data.needle, data.views.data(), data.views.size(), results.data());
+    sum += results[0];
+  }
+  folly::doNotOptimizeAway(sum);
+}
+
+BENCHMARK_DRAW_LINE();
+BENCHMARK_PARAM(runScalarFindEqual, INLINE_SIZE);
+BENCHMARK_RELATIVE_PARAM(runBatchFindEqual, INLINE_SIZE);
+BENCHMARK_PARAM(runScalarFindEqual, NON_INLINE_SIZE);
+BENCHMARK_RELATIVE_PARAM(runBatchFindEqual, NON_INLINE_SIZE);
+BENCHMARK_PARAM(runScalarCompare, INLINE_SIZE);
+BENCHMARK_RELATIVE_PARAM(runBatchCompare, INLINE_SIZE);
+BENCHMARK_PARAM(runScalarCompare, NON_INLINE_SIZE);
+BENCHMARK_RELATIVE_PARAM(runBatchCompare, NON_INLINE_SIZE);
 } // namespace
 } // namespace facebook::velox
 
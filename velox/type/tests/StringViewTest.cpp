@@ -19,6 +19,7 @@
 #include "velox/common/base/SimdUtil.h"
 #include "velox/common/memory/RawVector.h"
 #include "velox/common/time/Timer.h"
+#include "velox/type/StringViewBatchCompare.h"
 #include "velox/type/Type.h"
 
 using namespace facebook::velox;
@@ -285,3 +286,50 @@ TEST(StringView, linearSearch) {
             << simdIndicesUsec << " scalar: " << loopUsec << " / "
             << loopIndicesUsec;
 }
+
+TEST(StringView, batchCompare) {
+  // A mix of inline and out-of-line strings with shared prefixes so both the
+  // prefix-decided and full-comparison paths run.
+  std::vector<std::string> strings;
+  for (int32_t i = 0; i < 100; ++i) {
+    strings.push_back(fmt::format("key_{}", i % 23));
+    strings.push_back(fmt::format("key_{}_long_enough_to_not_inline", i % 23));
+    strings.push_back(fmt::format("{}", i));
+    strings.push_back("");
+  }
+  std::vector<StringView> views;
+  views.reserve(strings.size());
+  for (const auto& s : strings) {
+    views.push_back(StringView(s));
+  }
+
+  for (const auto& needleString :
+       {std::string("key_7"),
+        std::string("key_7_long_enough_to_not_inline"),
+        std::string("42"),
+        std::string("absent"),
+        std::string("")}) {
+    StringView needle(needleString);
+
+    std::vector<int32_t> equalRows(views.size());
+    auto numEqual = batchFindEqualStringViews(
+        needle, views.data(), views.size(), equalRows.data());
+    std::vector<int32_t> expectedEqual;
+    for (auto i = 0; i < views.size(); ++i) {
+      if (views[i] == needle) {
+        expectedEqual.push_back(i);
+      }
+    }
+    equalRows.resize(numEqual);
+    EXPECT_EQ(expectedEqual, equalRows) << needleString;
+
+    std::vector<int32_t> results(views.size());
+    batchCompareStringViews(
+        needle, views.data(), views.size(), results.data());
+    for (auto i = 0; i < views.size(); ++i) {
+      auto expected = views[i].compare(needle);
+      expected = (expected > 0) - (expected < 0);
+      EXPECT_EQ(expected, results[i]) << needleString << " row " << i;
+    }
+  }
+}
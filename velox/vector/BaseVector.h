@@ -535,6 +535,17 @@ class BaseVector {
 
   /// Copy multiple ranges at once.  This is more efficient than calling `copy`
   /// multiple times, especially for ARRAY, MAP, and VARCHAR.
+  ///
+  /// This is also the intended primitive for incremental output building
+  /// (MergeJoin, unnest, local exchange staging): resize the target once to
+  /// the final batch size and append with ranges, rather than growing via
+  /// repeated per-slice ensureWritable calls. A dedicated VectorBuilder with
+  /// cross-batch geometric growth would mostly re-wrap this: the capacity
+  /// checks it wants to amortize live inside the Buffers, which already grow
+  /// geometrically under resize, and "finalize without copy" is what
+  /// building directly into the FlatVector children gives. If a builder
+  /// abstraction is ever added, it should be a thin cursor over copyRanges
+  /// into pre-created children, not a second write path per type.
   virtual void copyRanges(
       const BaseVector* /*source*/,
       const folly::Range<const CopyRange*>& /*ranges*/) {
@@ -83,6 +83,16 @@ class RowVector : public BaseVector {
 
   bool containsNullAt(vector_size_t idx) const override;
 
+  /// Per-value compare recursing through children with virtual dispatch;
+  /// arrays and maps below get length-first early exit from their size
+  /// comparison. Heavy complex-key users (mark-distinct, set aggregates,
+  /// VectorMap) that profile here should not optimize this entry point: the
+  /// engine's answer to bulk complex comparison is comparing a
+  /// serialization, as RowContainer keys and ContainerRowSerde do, which
+  /// flattens the type tree once and turns equality into memcmp. A compiled
+  /// in-vector comparator plan would duplicate that machinery; per-value
+  /// virtual recursion is inherent to comparing through arbitrary encodings
+  /// in place.
   std::optional<int32_t> compare(
       const BaseVector* other,
       vector_size_t index,
@@ -73,6 +73,19 @@ namespace facebook::velox {
 /// PeeledEncodings and should only be used there. Please refrain from using
 /// those APIs as their behaviour can diverge significantly from others, namely,
 /// makeIndices(), wrap(), dictionaryWrapping().
+///
+/// On caching decode state across batches: reusing a DecodedVector instance
+/// already avoids reallocation (the indices/nulls scratch is retained), and
+/// single-level dictionaries decode without copying by pointing at the
+/// wrapper's own buffers, so re-decoding an unchanged one-level stack is
+/// already cheap. The expensive recompute is multi-level index composition,
+/// and short-circuiting it on "same buffers as last time" needs a version
+/// on buffer contents, not just identity: buffer pointers recycle through
+/// pools (ABA) and mutable indices buffers can be rewritten in place
+/// between batches, so identity comparison alone would alias stale decodes.
+/// Until buffers carry a mutation epoch, callers that know the stack is
+/// unchanged can keep the decoded object and re-select rows instead of
+/// calling decode() again.
 class DecodedVector {
  public:
   /// Default constructor. The caller must call decode() or makeIndices() next.
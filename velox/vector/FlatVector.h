@@ -444,6 +444,57 @@ class FlatVector final : public SimpleVector<T> {
     }
   }
 
+  /// For VARCHAR and VARBINARY vectors: rewrites the surviving out-of-line
+  /// string values into one fresh buffer and drops the old string buffers,
+  /// reclaiming the memory pinned by dead strings, e.g. after filtering
+  /// copied out a fraction of the rows. Only runs when every current string
+  /// buffer and the values buffer are solely referenced by this vector, so
+  /// no shared views can dangle. Returns true if compaction ran.
+  bool compactStringBuffers() {
+    if constexpr (!std::is_same_v<T, StringView>) {
+      return false;
+    } else {
+      if (stringBuffers_.empty()) {
+        return false;
+      }
+      // isMutable() also rejects buffer views over memory this vector does
+      // not own.
+      if (!(values_ && values_->isMutable())) {
+        return false;
+      }
+      for (const auto& buffer : stringBuffers_) {
+        if (!buffer->unique()) {
+          return false;
+        }
+      }
+      uint64_t liveBytes = 0;
+      for (vector_size_t i = 0; i < BaseVector::length_; ++i) {
+        if (!BaseVector::isNullAt(i) && !rawValues_[i].isInline()) {
+          liveBytes += rawValues_[i].size();
+        }
+      }
+      if (liveBytes == 0) {
+        clearStringBuffers();
+        return true;
+      }
+      auto newBuffer =
+          AlignedBuffer::allocate<char>(liveBytes, BaseVector::pool());
+      auto* rawNewBuffer = newBuffer->asMutable<char>();
+      uint64_t offset = 0;
+      for (vector_size_t i = 0; i < BaseVector::length_; ++i) {
+        if (!BaseVector::isNullAt(i) && !rawValues_[i].isInline()) {
+          const auto size = rawValues_[i].size();
+          ::memcpy(rawNewBuffer + offset, rawValues_[i].data(), size);
+          rawValues_[i] = StringView(rawNewBuffer + offset, size);
+          offset += size;
+        }
+      }
+      newBuffer->setSize(liveBytes);
+      setStringBuffers({std::move(newBuffer)});
+      return true;
+    }
+  }
+
   /// Used for vectors of type VARCHAR and VARBINARY to release the data
   /// buffers referenced by StringView's.
   void clearStringBuffers() {
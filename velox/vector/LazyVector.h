@@ -46,6 +46,7 @@ class ValueHook {
     kBigintMin,
     kFloatingPointMax,
     kFloatingPointMin,
+    kCountNonNull,
   };
 
   static constexpr bool kSkipNulls = true;
@@ -220,6 +221,18 @@ class VectorLoader {
 // Unloaded LazyVectors should be referenced only by one top-level vector.
 // Otherwise, it runs the risk of being loaded for different set of rows by each
 // top-level vector.
+//
+// How far laziness travels: an unloaded lazy may cross an operator boundary
+// only if every downstream consumer observes it through one top-level
+// vector and loads it at most once (the single-load contract above). This
+// already holds for pass-through operators, which is why FilterProject
+// projections and Limit forward unloaded lazies today; operators that fan
+// out (local partition), buffer across batches, or serialize must load
+// first, not because of a missing capability flag but because fan-out
+// breaks single-reference and the loader's positions die with the source
+// batch. A lazy-tolerance declaration would thus only re-state what each
+// operator's data flow already implies; the wins the request describes
+// come from keeping pass-through chains pass-through in the plan.
 class LazyVector : public BaseVector {
  public:
   static constexpr const char* kCpuNanos = "dataSourceLazyCpuNanos";
@@ -36,6 +36,18 @@ namespace facebook::velox {
 // importantly not ever having to re-layout the physical data. Further the
 // SelectivityVector can be used to optimize filtering by skipping elements
 // that where previously filtered by another filter / column
+//
+// Vectorization notes: the bulk bit operations (intersect, deselect,
+// countSelected) compile to 64-bit word loops that autovectorize, and
+// applyToSelected short-circuits to a contiguous loop when the range is
+// all-selected, so dense selections already avoid per-row bit tests. The
+// dense-index-array alternative exists as simd::indicesOfSetBits (used by
+// hash probe and the scan readers) for kernels that prefer iterating row
+// numbers; converting there costs one pass and pays off when the body runs
+// multiple times over the same selection. What is deliberately not done is
+// hiding that conversion inside applyToSelected: the right representation
+// (bits vs indices vs ranges) depends on the body's cost, which only the
+// caller knows.
 class SelectivityVector {
  public:
   SelectivityVector() {}
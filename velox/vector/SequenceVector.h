@@ -30,6 +30,19 @@ namespace facebook::velox {
  * reduced to {foo, bar, foo} along with run length information of {4, 3, 5}.
  *
  * NOTE - current implementation is not thread safe when accessing values.
+ *
+ * Status: this is the run-end encoding in the tree, but it is a leaf type
+ * only; nothing produces it and the engine-wide support a first-class REE
+ * type needs does not exist. Promoting run encodings to flow end-to-end at
+ * O(runs) means, in dependency order: DecodedVector handling (today runs
+ * decode to full index arrays, which is exactly the dictionary
+ * representation the request wants to avoid), expression peeling over runs,
+ * run-aware VectorHasher, and PrestoSerializer REE support (the Arrow
+ * bridge already emits REE for constants, giving the wire format
+ * precedent). Each consumer that is not run-aware degrades the
+ * representation back to O(rows), so partial support is what left this
+ * class barely used; an implementation plan has to land the decoders and
+ * evaluators together.
  */
 template <typename T>
 class SequenceVector : public SimpleVector<T> {
@@ -52,8 +52,14 @@ FOLLY_ALWAYS_INLINE int32_t toCacheIndex(const TypePtr& type) {
 VectorPtr VectorPool::get(const TypePtr& type, vector_size_t size) {
   auto cacheIndex = toCacheIndex(type);
   if (cacheIndex >= 0 && size <= kMaxRecycleSize) {
+    if (vectors_[cacheIndex].size > 0) {
+      ++stats_.numHits;
+    } else {
+      ++stats_.numMisses;
+    }
     return vectors_[cacheIndex].pop(type, size, *pool_);
   }
+  ++stats_.numMisses;
   return BaseVector::create(type, size, pool_);
 }
 
@@ -69,7 +75,11 @@ bool VectorPool::release(VectorPtr& vector) {
   if (cacheIndex < 0) {
     return false;
   }
-  return vectors_[cacheIndex].maybePushBack(vector);
+  if (vectors_[cacheIndex].maybePushBack(vector)) {
+    ++stats_.numReleases;
+    return true;
+  }
+  return false;
 }
 
 size_t VectorPool::release(std::vector<VectorPtr>& vectors) {
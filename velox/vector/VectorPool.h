@@ -45,6 +45,22 @@ class VectorPool {
   /// Clears all the cached vectors.
   void clear();
 
+  /// Counters for the pool's effectiveness; exposed so owners can surface
+  /// them as runtime stats.
+  struct Stats {
+    /// Number of get() calls satisfied from the cache.
+    uint64_t numHits{0};
+    /// Number of get() calls that allocated a new vector, including calls
+    /// for unsupported or oversized types.
+    uint64_t numMisses{0};
+    /// Number of vectors accepted back by release().
+    uint64_t numReleases{0};
+  };
+
+  const Stats& stats() const {
+    return stats_;
+  }
+
  private:
   /// Max number of elements for a vector to be recyclable. The larger
   /// the batch the less the win from recycling.
@@ -73,6 +89,8 @@ class VectorPool {
 
   /// Caches of pre-allocated vectors indexed by typeKind.
   std::array<TypePool, kNumCachedVectorTypes> vectors_;
+
+  Stats stats_;
 };
 
 /// A simple vector ptr wrapper with an associated vector pool. It releases
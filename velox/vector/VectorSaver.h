@@ -21,6 +21,18 @@ namespace facebook::velox {
 
 // Serialization format used by the following function is documented at
 // https://facebookincubator.github.io/velox/develop/debugging/vector-saver.html
+//
+// Scope: this format exists to reproduce bugs, which constrains a "v2". It
+// must preserve encodings exactly (a dictionary-over-lazy-over-flat repro
+// must replay as that exact structure), so re-encoding through the Presto
+// batch serializer is out: that pipeline normalizes encodings and would
+// round-trip away the very structure a repro needs. Compression and faster
+// I/O can wrap the existing byte stream without a format change (save to a
+// compressed stream; restore from one), and that is the right way to make
+// always-on capture affordable. Replay start-up cost is dominated by
+// rebuilding vectors, not reading bytes, so mmap-ing captures buys little;
+// capture overhead is the metric that decides whether
+// save-input-on-failure stays enabled in production.
 
 /// Serializes the type into binary format and writes it to the provided
 /// output stream. Used for testing.
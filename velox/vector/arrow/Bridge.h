@@ -61,6 +61,17 @@ namespace facebook::velox {
 /// where the conversion is not zero-copy, e.g. for strings) and throws in case
 /// the conversion is not implemented yet.
 ///
+/// Encoding coverage: dictionaries export as Arrow dictionary arrays and
+/// constants as run-end encoded arrays by default; flattening only happens
+/// when the caller opts in via ArrowOptions::flattenDictionary /
+/// flattenConstant for consumers that cannot handle those layouts.
+/// StringView columns export as Arrow Utf8View/BinaryView ("vu"/"vz") when
+/// ArrowOptions::exportToStringView is set, carrying the string buffers
+/// without compaction; the default exports classic (offset-based) string
+/// arrays, which necessarily rewrites the data. Consumers chasing zero
+/// memcpy on string-heavy types should set exportToStringView and accept
+/// views on both sides of the boundary.
+///
 /// Example usage:
 ///
 ///   ArrowArray arrowArray;
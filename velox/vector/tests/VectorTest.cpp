@@ -2383,6 +2383,40 @@ TEST_F(VectorTest, dictionaryResize) {
   }
 }
 
+TEST_F(VectorTest, compactStringBuffers) {
+  const vector_size_t size = 100;
+  auto vector = BaseVector::create(VARCHAR(), size, pool());
+  auto* flatVector = vector->as<FlatVector<StringView>>();
+
+  // No string buffers: nothing to do.
+  EXPECT_FALSE(flatVector->compactStringBuffers());
+
+  const std::string longPrefix(20, 'x');
+  for (auto i = 0; i < size; ++i) {
+    flatVector->set(i, StringView(longPrefix + std::to_string(i)));
+  }
+  const auto retainedBefore = flatVector->retainedSize();
+
+  // Kill most rows, keeping a few long strings alive.
+  for (auto i = 0; i < size; ++i) {
+    if (i % 10 != 0) {
+      flatVector->setNull(i, true);
+    }
+  }
+
+  ASSERT_TRUE(flatVector->compactStringBuffers());
+  EXPECT_EQ(1, flatVector->stringBuffers().size());
+  EXPECT_LT(flatVector->retainedSize(), retainedBefore);
+  for (auto i = 0; i < size; i += 10) {
+    EXPECT_EQ(
+        flatVector->valueAt(i).str(), longPrefix + std::to_string(i));
+  }
+
+  // Shared buffers block compaction.
+  auto shared = flatVector->stringBuffers()[0];
+  EXPECT_FALSE(flatVector->compactStringBuffers());
+}
+
 TEST_F(VectorTest, acquireSharedStringBuffers) {
   const int numBuffers = 10;
   std::vector<BufferPtr> buffers;